@@ -0,0 +1,81 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Barriers to synchronize N tasks at a rendezvous    */
+/****************************************************************/
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "Barrier.h"
+
+/** OS_enumInitBarrier
+ * @brief Initializes a barrier for a number of tasks, no task arrived yet.
+ */
+OS_tenuBarrierState OS_enumInitBarrier(OS_tstructBarrier* Add_structBarrier, u32 Copy_u32Parties){
+	if(!Copy_u32Parties)
+		return OS_BARRIER_ERROR;
+	Add_structBarrier->Parties = Copy_u32Parties;
+	Add_structBarrier->Arrived = 0;
+	Add_structBarrier->Generation = 0;
+	Add_structBarrier->WaitList = NULL;
+	return OS_BARRIER_INIT_OK;
+}
+
+/** OS_enumBarrierWait
+ * @brief Arrives at the barrier through SVC_BARRIER_WAIT, see the header for the steps.
+ */
+OS_tenuBarrierState OS_enumBarrierWait(OS_tstructBarrier* Add_structBarrier, u32 Copy_u32TicksToWait){
+	OS_tenuBarrierState Loc_enumState = OS_BARRIER_ERROR;
+
+	if(OS_IS_HANDLER_MODE())
+		return OS_BARRIER_ERROR;
+	OS_REQUEST_SERVICE_ARGS(SVC_BARRIER_WAIT, Add_structBarrier, Copy_u32TicksToWait, &Loc_enumState);
+	/* Blocked: released by the last task, or timed out */
+	if(Loc_enumState == OS_BARRIER_ERROR)
+		Loc_enumState = (OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK) ? OS_BARRIER_RELEASED : OS_BARRIER_TIMEOUT;
+	return Loc_enumState;
+}
+
+/** OS_enumBarrierWaitService
+ * @brief Kernel side of OS_enumBarrierWait, runs in Handler Mode with interrupts masked.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Counts the running task in `Arrived`. Tasks that timed out stay counted (the tick handler
+ *    does not know the barrier), so when the count reaches `Parties` the waiters are counted again
+ *    from the wait list, and the generation goes on if some of them left.
+ * 2. Last task: wakes the waiters in one pass of the wait list, resets `Arrived`, increments
+ *    `Generation`, reschedules once and returns OS_BARRIER_SERIAL.
+ * 3. Otherwise returns OS_BARRIER_TIMEOUT if no wait was requested, or blocks the task and returns
+ *    OS_BARRIER_ERROR, which tells the caller to read `Waiting.Result` when it runs again.
+ */
+OS_tenuBarrierState OS_enumBarrierWaitService(OS_tstructBarrier* Add_structBarrier, u32 Copy_u32TicksToWait){
+	OS_structTask* Loc_structTask;
+	u32 Loc_u32Arrived;
+
+	Add_structBarrier->Arrived++;
+	if(Add_structBarrier->Arrived >= Add_structBarrier->Parties){
+		Loc_u32Arrived = 1;
+		for(Loc_structTask = Add_structBarrier->WaitList ; Loc_structTask ; Loc_structTask = Loc_structTask->Waiting.NextWaiter)
+			Loc_u32Arrived++;
+		Add_structBarrier->Arrived = Loc_u32Arrived;
+	}
+	if(Add_structBarrier->Arrived >= Add_structBarrier->Parties){
+		while((Loc_structTask = OS_structWaitListPop(&Add_structBarrier->WaitList)) != NULL)
+			OS_voidWakeTask(Loc_structTask);
+		Add_structBarrier->Arrived = 0;
+		Add_structBarrier->Generation++;
+		OS_voidSchedule();
+		return OS_BARRIER_SERIAL;
+	}
+	if(!Copy_u32TicksToWait){
+		Add_structBarrier->Arrived--;
+		return OS_BARRIER_TIMEOUT;
+	}
+	OS_voidBlockCurrentTask(&Add_structBarrier->WaitList, Copy_u32TicksToWait);
+	return OS_BARRIER_ERROR;
+}
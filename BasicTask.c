@@ -0,0 +1,128 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Run-to-completion basic tasks on a shared stack    */
+/****************************************************************/
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Porting_CortexM.h"
+#include "MyRTOSConfig.h"
+#include "BasicTask.h"
+
+#if OS_BASIC_TASK_ENABLE == 1
+
+/* Basic task of each priority */
+static OS_tstructBasicTask* Global_structBasicTaskTable[OS_BASIC_TASK_PRIORITY_LEVELS];
+/* Bit p set: the basic task of priority p is activated and did not start yet */
+static volatile u32 Global_u32BasicTaskReady;
+/* Priority of the running basic task, -1 if none */
+static volatile s32 Global_s32BasicTaskRunning = -1;
+
+/* Ready basic tasks with a priority above Copy_s32Priority */
+static inline u32 OS_u32BasicTaskAbove(s32 Copy_s32Priority){
+	if(Copy_s32Priority < 0)
+		return Global_u32BasicTaskReady;
+	if(Copy_s32Priority >= (OS_BASIC_TASK_PRIORITY_LEVELS - 1))
+		return 0;
+	return Global_u32BasicTaskReady & ~((2UL << Copy_s32Priority) - 1);
+}
+
+/** OS_voidBasicTaskInit
+ * @brief Enables the dispatcher interrupt and lets unprivileged tasks pend it.
+ */
+void OS_voidBasicTaskInit(){
+	Global_u32BasicTaskReady = 0;
+	Global_s32BasicTaskRunning = -1;
+	NVIC_SetPriority(OS_BASIC_TASK_IRQn, OS_BASIC_TASK_IRQ_PRIORITY);
+	NVIC_EnableIRQ(OS_BASIC_TASK_IRQn);
+	SCB->CCR |= SCB_CCR_USERSETMPEND_Msk;
+}
+
+/** OS_enumBasicTaskCreate
+ * @brief Registers a basic task in the table of its priority.
+ */
+OS_enumErrorStatus OS_enumBasicTaskCreate(OS_tstructBasicTask* Add_structTask){
+	if(!Add_structTask->func || (Add_structTask->Priority >= OS_BASIC_TASK_PRIORITY_LEVELS))
+		return TASK_CREATION_ERROR;
+	if(Global_structBasicTaskTable[Add_structTask->Priority] &&
+	   (Global_structBasicTaskTable[Add_structTask->Priority] != Add_structTask))
+		return TASK_CREATION_ERROR;
+	Add_structTask->NoOfRuns = 0;
+	Global_structBasicTaskTable[Add_structTask->Priority] = Add_structTask;
+	return OS_OK;
+}
+
+/** OS_enumBasicTaskActivate
+ * @brief Sets the ready bit of a basic task and dispatches it, see the header for the cases.
+ */
+OS_enumErrorStatus OS_enumBasicTaskActivate(OS_tstructBasicTask* Add_structTask){
+	u32 Loc_u32Bit, Loc_u32Ready, Loc_u32State;
+
+	if((Add_structTask->Priority >= OS_BASIC_TASK_PRIORITY_LEVELS) ||
+	   (Global_structBasicTaskTable[Add_structTask->Priority] != Add_structTask))
+		return TASK_CREATION_ERROR;
+	Loc_u32Bit = 1UL << Add_structTask->Priority;
+
+	if(!OS_IS_HANDLER_MODE()){
+		// Unprivileged code cannot mask interrupts, the bit is set with an exclusive access
+		do{
+			Loc_u32Ready = __LDREXW(&Global_u32BasicTaskReady);
+		}while(__STREXW(Loc_u32Ready | Loc_u32Bit, &Global_u32BasicTaskReady));
+		NVIC->STIR = OS_BASIC_TASK_IRQn;
+		return OS_OK;
+	}
+
+	OS_ENTER_CRITICAL(Loc_u32State);
+	Global_u32BasicTaskReady |= Loc_u32Bit;
+	if(__get_IPSR() == (OS_BASIC_TASK_IRQn + 16)){
+		// Called by a basic task: nested call if the activated one has a higher priority
+		OS_EXIT_CRITICAL(Loc_u32State);
+		if(Add_structTask->Priority > Global_s32BasicTaskRunning)
+			OS_voidBasicTaskDispatch();
+		return OS_OK;
+	}
+	OS_EXIT_CRITICAL(Loc_u32State);
+	NVIC_SetPendingIRQ(OS_BASIC_TASK_IRQn);
+	return OS_OK;
+}
+
+/** OS_voidBasicTaskDispatch
+ * @brief Runs every ready basic task above the running priority, highest priority first.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Saves the priority of the running basic task (the caller when nested).
+ * 2. While a ready basic task has a higher priority: clears its ready bit, marks its priority as
+ *    running and calls it with interrupts enabled.
+ * 3. Restores the running priority of the caller.
+ */
+void OS_voidBasicTaskDispatch(){
+	s32 Loc_s32Caller = Global_s32BasicTaskRunning;
+	u32 Loc_u32Above, Loc_u32Priority, Loc_u32State;
+	OS_tstructBasicTask* Loc_structTask;
+
+	OS_ENTER_CRITICAL(Loc_u32State);
+	while((Loc_u32Above = OS_u32BasicTaskAbove(Loc_s32Caller)) != 0){
+		Loc_u32Priority = 31 - __builtin_clz(Loc_u32Above);
+		Global_u32BasicTaskReady &= ~(1UL << Loc_u32Priority);
+		Global_s32BasicTaskRunning = Loc_u32Priority;
+		Loc_structTask = Global_structBasicTaskTable[Loc_u32Priority];
+		OS_EXIT_CRITICAL(Loc_u32State);
+
+		Loc_structTask->func();
+		Loc_structTask->NoOfRuns++;
+
+		OS_ENTER_CRITICAL(Loc_u32State);
+	}
+	Global_s32BasicTaskRunning = Loc_s32Caller;
+	OS_EXIT_CRITICAL(Loc_u32State);
+}
+
+/* Dispatcher interrupt: an interrupt line the application does not use, pended by software */
+void OS_BASIC_TASK_IRQHandler(void){
+	OS_voidBasicTaskDispatch();
+}
+#endif
@@ -0,0 +1,136 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Condition variables used with the kernel mutex     */
+/****************************************************************/
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "Semaphore.h"
+#include "CondVar.h"
+
+/** OS_enumInitCondVar
+ * @brief Initializes a condition variable without waiters.
+ */
+OS_tenuCondVarState OS_enumInitCondVar(OS_tstructCondVar* Add_structCondVar){
+	Add_structCondVar->WaitList = NULL;
+	return OS_CONDVAR_INIT_OK;
+}
+
+/** OS_enumCondWait
+ * @brief Releases the mutex and blocks through SVC_CONDVAR_WAIT, see the header for the steps.
+ */
+OS_tenuCondVarState OS_enumCondWait(OS_tstructCondVar* Add_structCondVar, OS_tstructSemaphore* Add_structMutex, u32 Copy_u32TicksToWait){
+	if(OS_IS_HANDLER_MODE() || (Add_structMutex->currentOwner != OS_StructOS.CurrentTask))
+		return OS_CONDVAR_NOT_OWNER;
+
+	OS_REQUEST_SERVICE_ARGS(SVC_CONDVAR_WAIT, Add_structCondVar, Add_structMutex, Copy_u32TicksToWait);
+
+	/* Signaled: the mutex was handed to the task before it was woken */
+	if(OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK)
+		return OS_CONDVAR_SIGNALED;
+	/* The caller must know whether it holds the mutex again */
+	if(OS_enumAcquireSemaphore(Add_structMutex, OS_WAIT_FOREVER) != OS_SEMAPHORE_AVAILABLE)
+		return OS_CONDVAR_MUTEX_LOST;
+	return OS_CONDVAR_TIMEOUT;
+}
+
+/* Signal and broadcast: through SVC_CONDVAR_SIGNAL from a task, directly from an interrupt handler */
+static void OS_voidCondSignal(OS_tstructCondVar* Add_structCondVar, u8 Copy_u8All){
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidCondSignalService(Add_structCondVar, Copy_u8All);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_CONDVAR_SIGNAL, Add_structCondVar, Copy_u8All, 0);
+	}
+}
+
+/** OS_enumCondSignal
+ * @brief Moves the highest priority waiting task to its mutex.
+ */
+OS_tenuCondVarState OS_enumCondSignal(OS_tstructCondVar* Add_structCondVar){
+	if(Add_structCondVar->WaitList)
+		OS_voidCondSignal(Add_structCondVar, 0);
+	return OS_CONDVAR_SIGNALED;
+}
+
+/** OS_enumCondBroadcast
+ * @brief Moves all the waiting tasks to their mutex.
+ */
+OS_tenuCondVarState OS_enumCondBroadcast(OS_tstructCondVar* Add_structCondVar){
+	if(Add_structCondVar->WaitList)
+		OS_voidCondSignal(Add_structCondVar, 1);
+	return OS_CONDVAR_SIGNALED;
+}
+
+/** OS_voidCondWaitService
+ * @brief Kernel side of OS_enumCondWait, runs in Handler Mode with interrupts masked.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Releases the mutex: hands it to its highest priority waiter (made ready), or gives the
+ *    resource back and clears OS_SEMAPHORE_WAITERS when nobody waits.
+ * 2. Records the mutex in `Waiting.Data` and blocks the running task on the condition variable
+ *    with `OS_voidBlockCurrentTask`, which reschedules once for both steps.
+ */
+void OS_voidCondWaitService(OS_tstructCondVar* Add_structCondVar, OS_tstructSemaphore* Add_structMutex, u32 Copy_u32TicksToWait){
+	OS_structTask* Loc_structTask = OS_structWaitListPop(&Add_structMutex->WaitList);
+
+	if(Loc_structTask){
+		Add_structMutex->currentOwner = Loc_structTask;
+		if(!Add_structMutex->WaitList)
+			Add_structMutex->s &= ~OS_SEMAPHORE_WAITERS;
+		OS_voidWakeTask(Loc_structTask);
+	}
+	else{
+		Add_structMutex->currentOwner = NULL;
+		Add_structMutex->s = (Add_structMutex->s & ~OS_SEMAPHORE_WAITERS) + 1;
+	}
+	OS_StructOS.CurrentTask->Waiting.Data = Add_structMutex;
+	OS_voidBlockCurrentTask(&Add_structCondVar->WaitList, Copy_u32TicksToWait);
+}
+
+/** OS_voidCondSignalService
+ * @brief Kernel side of signal (one waiter) and broadcast (all), runs in Handler Mode with
+ *        interrupts masked.
+ *
+ * @details
+ * For each waiter taken from the condition variable, highest priority first:
+ * 1. Removes it from the timeout list, from now on it only waits for the mutex.
+ * 2. If the mutex is free, takes it for the task and makes the task ready.
+ * 3. Otherwise inserts the task in the mutex wait list by priority and sets OS_SEMAPHORE_WAITERS,
+ *    so the release of the mutex hands it over.
+ * The scheduler runs once at the end if a task was made ready.
+ */
+void OS_voidCondSignalService(OS_tstructCondVar* Add_structCondVar, u8 Copy_u8All){
+	OS_structTask* Loc_structTask;
+	OS_tstructSemaphore* Loc_structMutex;
+	u8 Loc_u8Woken = 0;
+
+	while((Loc_structTask = OS_structWaitListPop(&Add_structCondVar->WaitList)) != NULL){
+		Loc_structMutex = (OS_tstructSemaphore*)Loc_structTask->Waiting.Data;
+		OS_voidTimeoutRemove(Loc_structTask);
+		if(Loc_structMutex->s & ~OS_SEMAPHORE_WAITERS){
+			Loc_structMutex->s--;
+			Loc_structMutex->currentOwner = Loc_structTask;
+			OS_voidWakeTask(Loc_structTask);
+			Loc_u8Woken = 1;
+		}
+		else{
+			Loc_structMutex->s |= OS_SEMAPHORE_WAITERS;
+			OS_voidWaitListInsert(&Loc_structMutex->WaitList, Loc_structTask);
+		}
+		if(!Copy_u8All)
+			break;
+	}
+	if(Loc_u8Woken)
+		OS_voidSchedule();
+}
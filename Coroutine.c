@@ -0,0 +1,264 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Stackless coroutines multiplexed on one task       */
+/****************************************************************/
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "MyRTOSConfig.h"
+#include "Coroutine.h"
+
+/* Appends a coroutine to the ready list of its host */
+static inline void OS_voidCoroutineReady(OS_tstructCoroutineHost* Add_structHost, OS_tstructCoroutine* Add_structCoroutine){
+	Add_structCoroutine->Next = NULL;
+	if(Add_structHost->ReadyTail)
+		Add_structHost->ReadyTail->Next = Add_structCoroutine;
+	else
+		Add_structHost->ReadyHead = Add_structCoroutine;
+	Add_structHost->ReadyTail = Add_structCoroutine;
+}
+
+/* Decrements the count of a signal, ISRs increment it at any time */
+static inline u8 OS_u8CoroutineSignalDecrement(OS_tstructCoroutineSignal* Add_structSignal){
+	u32 Loc_u32Count;
+	do{
+		Loc_u32Count = __LDREXW(&Add_structSignal->Count);
+		if(!Loc_u32Count){
+			__CLREX();
+			return 0;
+		}
+	}while(__STREXW(Loc_u32Count - 1, &Add_structSignal->Count));
+	return 1;
+}
+
+/** OS_voidCoroutineHostInit
+ * @brief Initializes a host with empty lists.
+ */
+void OS_voidCoroutineHostInit(OS_tstructCoroutineHost* Add_structHost){
+	Add_structHost->ReadyHead = NULL;
+	Add_structHost->ReadyTail = NULL;
+	Add_structHost->DelayedList = NULL;
+	Add_structHost->PolledList = NULL;
+	Add_structHost->Signaled = NULL;
+	Add_structHost->WaitList = NULL;
+	Add_structHost->NoOfCoroutines = 0;
+}
+
+/** OS_enumCoroutineStart
+ * @brief Resets the resume point of a coroutine and makes it ready in its host.
+ */
+OS_enumErrorStatus OS_enumCoroutineStart(OS_tstructCoroutineHost* Add_structHost, OS_tstructCoroutine* Add_structCoroutine){
+	if(!Add_structCoroutine->func)
+		return TASK_CREATION_ERROR;
+	Add_structCoroutine->Line = 0;
+	Add_structCoroutine->Host = Add_structHost;
+	Add_structHost->NoOfCoroutines++;
+	OS_voidCoroutineReady(Add_structHost, Add_structCoroutine);
+	return OS_OK;
+}
+
+/** OS_voidCoroutineDelay
+ * @brief Inserts the coroutine in the delayed list of its host, sorted by wake tick.
+ *
+ * Coroutines with the same wake tick keep their order. Tick differences are compared as
+ * signed numbers so the tick counter may wrap around.
+ */
+void OS_voidCoroutineDelay(OS_tstructCoroutine* Add_structCoroutine, u32 Copy_u32NoOfTicks){
+	OS_tstructCoroutine** Loc_structLink = &Add_structCoroutine->Host->DelayedList;
+
+	Add_structCoroutine->WakeTick = OS_StructOS.TickCount + Copy_u32NoOfTicks;
+	while(*Loc_structLink && ((s32)((*Loc_structLink)->WakeTick - Add_structCoroutine->WakeTick) <= 0))
+		Loc_structLink = &((*Loc_structLink)->Next);
+	Add_structCoroutine->Next = *Loc_structLink;
+	*Loc_structLink = Add_structCoroutine;
+}
+
+/** OS_voidCoroutinePoll
+ * @brief Queues the coroutine to check its condition again at the next pass of its host.
+ */
+void OS_voidCoroutinePoll(OS_tstructCoroutine* Add_structCoroutine){
+	Add_structCoroutine->Next = Add_structCoroutine->Host->PolledList;
+	Add_structCoroutine->Host->PolledList = Add_structCoroutine;
+}
+
+/** OS_u8CoroutineSignalTake
+ * @brief Takes a signal if its count is not 0, else queues the coroutine as a waiter.
+ *
+ * @details
+ * 1. Records the host in the signal before the count is read, a signal given after the read
+ *    then finds the host and queues itself in the Signaled list.
+ * 2. Decrements the count with LDREX / STREX, returns 1 on success.
+ * 3. Otherwise appends the coroutine to the waiters and returns 0.
+ */
+u8 OS_u8CoroutineSignalTake(OS_tstructCoroutine* Add_structCoroutine, OS_tstructCoroutineSignal* Add_structSignal){
+	OS_tstructCoroutine** Loc_structLink = &Add_structSignal->Waiters;
+
+	Add_structSignal->Host = Add_structCoroutine->Host;
+	__DMB();
+	if(!Add_structSignal->Waiters && OS_u8CoroutineSignalDecrement(Add_structSignal))
+		return 1;
+
+	while(*Loc_structLink)
+		Loc_structLink = &((*Loc_structLink)->Next);
+	Add_structCoroutine->Next = NULL;
+	*Loc_structLink = Add_structCoroutine;
+	return 0;
+}
+
+/* Moves every coroutine that may continue to the ready list (step 1 of OS_voidCoroutineRun) */
+static void OS_voidCoroutineCollect(OS_tstructCoroutineHost* Add_structHost){
+	OS_tstructCoroutineSignal* Loc_structSignal;
+	OS_tstructCoroutine* Loc_structCoroutine;
+
+	/* Signals given since the last pass, the list is taken whole */
+	do{
+		Loc_structSignal = (OS_tstructCoroutineSignal*)__LDREXW((volatile u32*)&Add_structHost->Signaled);
+	}while(__STREXW(0, (volatile u32*)&Add_structHost->Signaled));
+	while(Loc_structSignal){
+		OS_tstructCoroutineSignal* Loc_structNext = Loc_structSignal->NextPending;
+		/* Cleared before the count is read: a signal given from now on is queued again */
+		Loc_structSignal->Pending = 0;
+		__DMB();
+		while(Loc_structSignal->Waiters && OS_u8CoroutineSignalDecrement(Loc_structSignal)){
+			Loc_structCoroutine = Loc_structSignal->Waiters;
+			Loc_structSignal->Waiters = Loc_structCoroutine->Next;
+			OS_voidCoroutineReady(Add_structHost, Loc_structCoroutine);
+		}
+		Loc_structSignal = Loc_structNext;
+	}
+
+	/* Elapsed delays */
+	while(Add_structHost->DelayedList &&
+	      ((s32)(Add_structHost->DelayedList->WakeTick - OS_StructOS.TickCount) <= 0)){
+		Loc_structCoroutine = Add_structHost->DelayedList;
+		Add_structHost->DelayedList = Loc_structCoroutine->Next;
+		OS_voidCoroutineReady(Add_structHost, Loc_structCoroutine);
+	}
+
+	/* Conditions are checked again */
+	while(Add_structHost->PolledList){
+		Loc_structCoroutine = Add_structHost->PolledList;
+		Add_structHost->PolledList = Loc_structCoroutine->Next;
+		OS_voidCoroutineReady(Add_structHost, Loc_structCoroutine);
+	}
+}
+
+/** OS_voidCoroutineRun
+ * @brief Runs the coroutines of a host forever, see the header for the steps.
+ */
+void OS_voidCoroutineRun(OS_tstructCoroutineHost* Add_structHost){
+	OS_tstructCoroutine* Loc_structCoroutine;
+	OS_tstructCoroutine* Loc_structLast;
+	u32 Loc_u32Ticks;
+
+	while(1){
+		OS_voidCoroutineCollect(Add_structHost);
+
+		/* One pass: coroutines yielded during it run in the next one */
+		Loc_structLast = Add_structHost->ReadyTail;
+		while(Loc_structLast){
+			Loc_structCoroutine = Add_structHost->ReadyHead;
+			Add_structHost->ReadyHead = Loc_structCoroutine->Next;
+			if(!Add_structHost->ReadyHead)
+				Add_structHost->ReadyTail = NULL;
+
+			switch(Loc_structCoroutine->func(Loc_structCoroutine)){
+				case OS_CO_YIELDED:
+					OS_voidCoroutineReady(Add_structHost, Loc_structCoroutine);
+				break;
+				case OS_CO_ENDED:
+					Add_structHost->NoOfCoroutines--;
+				break;
+				case OS_CO_WAITING:
+				break;
+			}
+			if(Loc_structCoroutine == Loc_structLast)
+				break;
+		}
+		if(Add_structHost->ReadyHead)
+			continue;
+
+		/* Nothing ready: block until a signal, the first delay or the next poll */
+		Loc_u32Ticks = OS_WAIT_FOREVER;
+		if(Add_structHost->PolledList)
+			Loc_u32Ticks = OS_COROUTINE_POLL_TICKS;
+		if(Add_structHost->DelayedList){
+			s32 Loc_s32Left = (s32)(Add_structHost->DelayedList->WakeTick - OS_StructOS.TickCount);
+			if(Loc_s32Left <= 0)
+				continue;
+			if((u32)Loc_s32Left < Loc_u32Ticks)
+				Loc_u32Ticks = Loc_s32Left;
+		}
+		OS_REQUEST_SERVICE_ARGS(SVC_COROUTINE_WAIT, Add_structHost, Loc_u32Ticks, 0);
+	}
+}
+
+/** OS_voidCoroutineSignalInit
+ * @brief Initializes a signal with a count of 0 and no waiter.
+ */
+void OS_voidCoroutineSignalInit(OS_tstructCoroutineSignal* Add_structSignal){
+	Add_structSignal->Count = 0;
+	Add_structSignal->Pending = 0;
+	Add_structSignal->Waiters = NULL;
+	Add_structSignal->Host = NULL;
+	Add_structSignal->NextPending = NULL;
+}
+
+/** OS_voidCoroutineSignal
+ * @brief Gives a signal: directly from an ISR, through SVC_COROUTINE_SIGNAL from a task.
+ */
+void OS_voidCoroutineSignal(OS_tstructCoroutineSignal* Add_structSignal){
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidCoroutineSignalService(Add_structSignal);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_COROUTINE_SIGNAL, Add_structSignal, 0, 0);
+	}
+}
+
+/** OS_voidCoroutineWaitService
+ * @brief Kernel side of the host wait, runs in Handler Mode.
+ *
+ * The Signaled list is checked again with interrupts masked so a signal given between the
+ * last pass and the SVC is not missed.
+ */
+void OS_voidCoroutineWaitService(OS_tstructCoroutineHost* Add_structHost, u32 Copy_u32TicksToWait){
+	if(!Add_structHost->Signaled)
+		OS_voidBlockCurrentTask((OS_structTask**)&Add_structHost->WaitList, Copy_u32TicksToWait);
+}
+
+/** OS_voidCoroutineSignalService
+ * @brief Kernel side of OS_voidCoroutineSignal, runs in Handler Mode with interrupts masked.
+ *
+ * @details
+ * 1. Increments the count, the host gives it to the first waiter in its next pass.
+ * 2. Queues the signal once in the Signaled list of its host (a signal no coroutine waited on
+ *    yet only keeps the count).
+ * 3. Wakes the host task if it is blocked.
+ */
+void OS_voidCoroutineSignalService(OS_tstructCoroutineSignal* Add_structSignal){
+	OS_tstructCoroutineHost* Loc_structHost = Add_structSignal->Host;
+	OS_structTask* Loc_structTask;
+
+	Add_structSignal->Count++;
+	if(!Loc_structHost || Add_structSignal->Pending)
+		return;
+	Add_structSignal->Pending = 1;
+	Add_structSignal->NextPending = Loc_structHost->Signaled;
+	Loc_structHost->Signaled = Add_structSignal;
+
+	Loc_structTask = OS_structWaitListPop((OS_structTask**)&Loc_structHost->WaitList);
+	if(Loc_structTask){
+		OS_voidWakeTask(Loc_structTask);
+		OS_voidSchedule();
+	}
+}
@@ -5,89 +5,132 @@
  *      Author: mh_sm
  */
 
-#include "FIFO.h"
 #include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
 #include "EventGroup.h"
 
-
+/* Condition of a wait request on the current flags */
+static inline u8 OS_u8EventMatches(u32 Copy_u32Flags, const OS_tstructEventWait* Add_structWait){
+	if(Add_structWait->WaitForAll)
+		return (Copy_u32Flags & Add_structWait->Bits) == Add_structWait->Bits;
+	return (Copy_u32Flags & Add_structWait->Bits) != 0;
+}
 
 OS_tenuEventState OS_enumCreateEventGroup(OS_tstructEvent* Add_structEvent){
 	Add_structEvent->bits = 0;
-	OS_enumFifoInit (&(Add_structEvent->Global_structWaitingQueue),Add_structEvent->Global_structWaitingQueueFIFO , 100);
+	Add_structEvent->WaitList = NULL;
 	return OS_EVENT_INIT_OK;
 }
 
-u16 OS_u16EventsWaitBits(OS_tstructEvent* Add_structEvent,u16 Copy_u16Bits, u8 Copy_u8WaitForAll,u8 Copy_u8ClearOnReturn , u8 Copy_u8TickToWait){
-
-	u16 Loc_u8waitingBits = Copy_u16Bits;
-
-
-	if(Copy_u8WaitForAll && (Add_structEvent->bits == Loc_u8waitingBits)){ // All are set.
-		u16 Loc_u16ReturnedMask = Add_structEvent->bits;
-		if(Copy_u8ClearOnReturn)
-			Add_structEvent->bits = 0;
-		return Loc_u16ReturnedMask;
-	}
-
-	if(!Copy_u8WaitForAll &&  Add_structEvent->bits && (Add_structEvent->bits <= Loc_u8waitingBits)){
-		u16 Loc_u16ReturnedMask = Add_structEvent->bits;
-		if(Copy_u8ClearOnReturn)
-			Add_structEvent->bits = 0;
-		return Loc_u16ReturnedMask;
+/** OS_u32EventsWaitBits
+ * @brief Checks the condition in the kernel and blocks until it is met, see the header for the steps.
+ */
+u32 OS_u32EventsWaitBits(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits, u8 Copy_u8WaitForAll, u8 Copy_u8ClearOnReturn, u32 Copy_u32TicksToWait){
+	OS_tstructEventWait Loc_structWait;
+	u32 Loc_u32State;
+
+	if(!Copy_u32Bits)
+		return 0;
+	Loc_structWait.Bits = Copy_u32Bits;
+	Loc_structWait.WaitForAll = Copy_u8WaitForAll;
+	Loc_structWait.ClearOnReturn = Copy_u8ClearOnReturn;
+	Loc_structWait.Result = 0;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidEventWaitService(Add_structEvent, &Loc_structWait, 0);
+		OS_EXIT_CRITICAL(Loc_u32State);
 	}
-
-	if(Add_structEvent->bits && (Add_structEvent->bits > Loc_u8waitingBits)){
-		if(Copy_u8ClearOnReturn)
-			Add_structEvent->bits = 0;
-		return OS_EVENT_NOT_SET; // Invalid
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_EVENT_WAIT, Add_structEvent, &Loc_structWait, Copy_u32TicksToWait);
 	}
+	return Loc_structWait.Result;
+}
 
+/** OS_enumSetEvent
+ * @brief Sets flags through SVC_EVENT_SET, or directly from an interrupt handler.
+ */
+OS_tenuEventState OS_enumSetEvent(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits){
+	if(OS_IS_HANDLER_MODE())
+		return OS_enumSetEventFromISR(Add_structEvent, Copy_u32Bits);
+	OS_REQUEST_SERVICE_ARGS(SVC_EVENT_SET, Add_structEvent, Copy_u32Bits, 0);
+	return OS_EVENT_SET;
+}
 
-	if(Copy_u8TickToWait){
-		OS_structTask * Loc_structCurrentTask = OS_StructOS.CurrentTask;
-		Add_structEvent->noOfWaiting++;
-		OS_enumFifoEnqueue(&(Add_structEvent->Global_structWaitingQueue), &Loc_structCurrentTask);
-		OS_enumDelayTask(Loc_structCurrentTask,Copy_u8TickToWait);
-	}
-
-	/* After Activation of task*/
+/** OS_enumSetEventFromISR
+ * @brief Sets flags with interrupts masked, any ISR may call it.
+ */
+OS_tenuEventState OS_enumSetEventFromISR(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits){
+	u32 Loc_u32State;
 
-	if(Copy_u8WaitForAll && (Add_structEvent->bits == Loc_u8waitingBits)){ // All are set.
-		u16 Loc_u16ReturnedMask = Add_structEvent->bits;
-		if(Copy_u8ClearOnReturn)
-			Add_structEvent->bits = 0;
-		return Loc_u16ReturnedMask;
-	}
+	OS_ENTER_CRITICAL(Loc_u32State);
+	OS_voidEventSetService(Add_structEvent, Copy_u32Bits);
+	OS_EXIT_CRITICAL(Loc_u32State);
+	return OS_EVENT_SET;
+}
 
-	if(!Copy_u8WaitForAll &&  Add_structEvent->bits && (Add_structEvent->bits <= Loc_u8waitingBits)){
-		u16 Loc_u16ReturnedMask = Add_structEvent->bits;
-		if(Copy_u8ClearOnReturn)
-			Add_structEvent->bits = 0;
-		return Loc_u16ReturnedMask;
-	}
+/** OS_u32ClearEvent
+ * @brief Clears flags, setters run with interrupts masked so the exclusive store fails if one
+ *        ran in between and the clear is retried.
+ */
+u32 OS_u32ClearEvent(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits){
+	u32 Loc_u32Flags;
+	do{
+		Loc_u32Flags = __LDREXW(&Add_structEvent->bits);
+	}while(__STREXW(Loc_u32Flags & ~Copy_u32Bits, &Add_structEvent->bits));
+	return Loc_u32Flags;
+}
 
-	if(Add_structEvent->bits && (Add_structEvent->bits > Loc_u8waitingBits)){
-		if(Copy_u8ClearOnReturn)
-			Add_structEvent->bits = 0;
-		return OS_EVENT_NOT_SET; // Invalid
+/** OS_voidEventWaitService
+ * @brief Kernel side of the wait: takes the flags if the condition is met, else blocks the running
+ *        task with its request (0 ticks: returns with a result of 0).
+ */
+void OS_voidEventWaitService(OS_tstructEvent* Add_structEvent, OS_tstructEventWait* Add_structWait, u32 Copy_u32TicksToWait){
+	u32 Loc_u32Flags = Add_structEvent->bits;
+
+	if(OS_u8EventMatches(Loc_u32Flags, Add_structWait)){
+		Add_structWait->Result = Loc_u32Flags;
+		if(Add_structWait->ClearOnReturn)
+			Add_structEvent->bits = Loc_u32Flags & ~Add_structWait->Bits;
+		return;
 	}
-
-	if(Copy_u8ClearOnReturn)
-		Add_structEvent->bits = 0;
-
-	return OS_EVENT_NOT_SET;
-
+	Add_structWait->Result = 0;
+	if(!Copy_u32TicksToWait)
+		return;
+	OS_StructOS.CurrentTask->Waiting.Data = Add_structWait;
+	OS_voidBlockCurrentTask(&Add_structEvent->WaitList, Copy_u32TicksToWait);
 }
 
-OS_tenuEventState OS_enumSetEvent(OS_tstructEvent* Add_structEvent,u16 Copy_u16Bits){
-
-	Add_structEvent->bits |= Copy_u16Bits;
-
-	//OS_enumActivateMultipleTasks(&(Add_structEvent->Global_structWaitingQueue),Add_structEvent->noOfWaiting);
-
-	Add_structEvent->noOfWaiting = 0;
-
-	return OS_EVENT_SET;
+/** OS_voidEventSetService
+ * @brief Kernel side of OS_enumSetEvent, runs in Handler Mode with interrupts masked.
+ *
+ * One walk of the wait list wakes every satisfied waiter, the flags they clear are combined and
+ * cleared after the walk, and the scheduler runs once.
+ */
+void OS_voidEventSetService(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits){
+	OS_structTask* Loc_structTask = Add_structEvent->WaitList;
+	OS_structTask* Loc_structNext;
+	OS_tstructEventWait* Loc_structWait;
+	u32 Loc_u32Flags = Add_structEvent->bits | Copy_u32Bits;
+	u32 Loc_u32ClearMask = 0;
+	u8 Loc_u8Woken = 0;
+
+	while(Loc_structTask){
+		Loc_structNext = Loc_structTask->Waiting.NextWaiter;
+		Loc_structWait = (OS_tstructEventWait*)Loc_structTask->Waiting.Data;
+		if(OS_u8EventMatches(Loc_u32Flags, Loc_structWait)){
+			Loc_structWait->Result = Loc_u32Flags;
+			if(Loc_structWait->ClearOnReturn)
+				Loc_u32ClearMask |= Loc_structWait->Bits;
+			OS_voidWaitListRemove(Loc_structTask);
+			OS_voidWakeTask(Loc_structTask);
+			Loc_u8Woken = 1;
+		}
+		Loc_structTask = Loc_structNext;
+	}
+	Add_structEvent->bits = Loc_u32Flags & ~Loc_u32ClearMask;
+	if(Loc_u8Woken)
+		OS_voidSchedule();
 }
-
-
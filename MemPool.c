@@ -0,0 +1,172 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Fixed-size block pools with O(1) allocate and free */
+/****************************************************************/
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "MemPool.h"
+
+/** OS_enumPoolCreate
+ * @brief Splits a static array into fixed-size blocks and links them in the free list.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Checks the storage is not NULL and word aligned and the block size and count are not 0.
+ * 2. Rounds the block size up to a multiple of 4 so every block can hold the free list link.
+ * 3. Links the blocks in address order, so the first allocations are the lowest addresses.
+ * 4. Resets the statistics and the wait list.
+ */
+OS_tenuPoolState OS_enumPoolCreate(OS_tstructPool* Add_structPool, void* Add_voidMemory, u32 Copy_u32BlockSize, u32 Copy_u32NoOfBlocks){
+	OS_tstructPoolBlock* Loc_structBlock;
+	u32 Loc_u32Index;
+
+	if(!Add_voidMemory || ((u32)Add_voidMemory & (sizeof(u32) - 1)) || !Copy_u32BlockSize || !Copy_u32NoOfBlocks)
+		return OS_POOL_INIT_ERROR;
+
+	Add_structPool->BlockSize  = OS_POOL_BLOCK_WORDS(Copy_u32BlockSize) * sizeof(u32);
+	Add_structPool->NoOfBlocks = Copy_u32NoOfBlocks;
+	Add_structPool->Start      = (u8*)Add_voidMemory;
+	Add_structPool->End        = Add_structPool->Start + (Add_structPool->BlockSize * Copy_u32NoOfBlocks);
+
+	for(Loc_u32Index = 0 ; Loc_u32Index < Copy_u32NoOfBlocks ; Loc_u32Index++){
+		Loc_structBlock = (OS_tstructPoolBlock*)(Add_structPool->Start + (Loc_u32Index * Add_structPool->BlockSize));
+		Loc_structBlock->Next = (Loc_u32Index + 1 < Copy_u32NoOfBlocks) ? (OS_tstructPoolBlock*)((u8*)Loc_structBlock + Add_structPool->BlockSize) : NULL;
+	}
+
+	Add_structPool->FreeList      = (OS_tstructPoolBlock*)Add_structPool->Start;
+	Add_structPool->NoOfFree      = Copy_u32NoOfBlocks;
+	Add_structPool->MinFree       = Copy_u32NoOfBlocks;
+	Add_structPool->AllocWaitList = NULL;
+
+	return OS_POOL_INIT_OK;
+}
+
+/* Unlinks the first free block, the caller masks interrupts */
+static void* OS_pvPoolPop(OS_tstructPool* Add_structPool){
+	OS_tstructPoolBlock* Loc_structBlock = Add_structPool->FreeList;
+
+	if(Loc_structBlock){
+		Add_structPool->FreeList = Loc_structBlock->Next;
+		if(--Add_structPool->NoOfFree < Add_structPool->MinFree)
+			Add_structPool->MinFree = Add_structPool->NoOfFree;
+	}
+	return Loc_structBlock;
+}
+
+/** OS_voidPoolAllocService
+ * @brief Kernel side of OS_enumPoolAlloc for tasks, runs in Handler Mode.
+ *
+ * @details
+ * 1. If a block is free it is unlinked and written to `*Add_pvBlock`.
+ * 2. Otherwise the caller is blocked on the allocation wait list (unless no wait was requested),
+ *    keeping `Add_pvBlock` in `Waiting.Data` for the freeing side to fill.
+ */
+void OS_voidPoolAllocService(OS_tstructPool* Add_structPool, void** Add_pvBlock, u32 Copy_u32TicksToWait){
+	OS_structTask* Loc_structCurrentTask = OS_StructOS.CurrentTask;
+
+	Loc_structCurrentTask->Waiting.Result = OS_TASK_WAIT_OK;
+	*Add_pvBlock = OS_pvPoolPop(Add_structPool);
+
+	if(*Add_pvBlock)
+		return;
+
+	if(Copy_u32TicksToWait){
+		Loc_structCurrentTask->Waiting.Data = Add_pvBlock;
+		OS_voidBlockCurrentTask(&Add_structPool->AllocWaitList, Copy_u32TicksToWait);
+	}
+	else{
+		Loc_structCurrentTask->Waiting.Result = OS_TASK_WAIT_TIMEOUT;
+	}
+}
+
+/** OS_voidPoolFreeService
+ * @brief Kernel side of OS_enumPoolFree, runs in Handler Mode.
+ *
+ * @details
+ * 1. If a task is blocked waiting for a block, the block is handed directly to it and it is woken.
+ * 2. Otherwise the block is linked at the head of the free list.
+ */
+void OS_voidPoolFreeService(OS_tstructPool* Add_structPool, void* Add_voidBlock){
+	OS_structTask* Loc_structWaiter = OS_structWaitListPop(&Add_structPool->AllocWaitList);
+
+	if(Loc_structWaiter){
+		*(void**)Loc_structWaiter->Waiting.Data = Add_voidBlock;
+		OS_voidWakeTask(Loc_structWaiter);
+		OS_voidSchedule();
+	}
+	else{
+		((OS_tstructPoolBlock*)Add_voidBlock)->Next = Add_structPool->FreeList;
+		Add_structPool->FreeList = (OS_tstructPoolBlock*)Add_voidBlock;
+		Add_structPool->NoOfFree++;
+	}
+}
+
+/** OS_enumPoolAlloc
+ * @brief Takes a block from the pool in O(1).
+ *
+ * From an ISR the block is unlinked with interrupts masked. From a task the work is done by
+ * OS_voidPoolAllocService through SVC_POOL_ALLOC, when the task runs again `Waiting.Result`
+ * tells whether a block was allocated.
+ */
+OS_tenuPoolState OS_enumPoolAlloc(OS_tstructPool* Add_structPool, void** Add_pvBlock, u32 Copy_u32TicksToWait){
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		*Add_pvBlock = OS_pvPoolPop(Add_structPool);
+		OS_EXIT_CRITICAL(Loc_u32State);
+		return *Add_pvBlock ? OS_POOL_OK : OS_POOL_EMPTY;
+	}
+
+	*Add_pvBlock = NULL;
+	OS_REQUEST_SERVICE_ARGS(SVC_POOL_ALLOC, Add_structPool, Add_pvBlock, Copy_u32TicksToWait);
+
+	if(OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK)
+		return OS_POOL_OK;
+	return Copy_u32TicksToWait ? OS_POOL_TIMEOUT : OS_POOL_EMPTY;
+}
+
+/** OS_enumPoolFree
+ * @brief Gives a block back to the pool in O(1).
+ *
+ * The address is checked against the pool bounds and the block grid before the free list is
+ * touched, then the block is given back directly from an ISR or through SVC_POOL_FREE from a task.
+ */
+OS_tenuPoolState OS_enumPoolFree(OS_tstructPool* Add_structPool, void* Add_voidBlock){
+	u8* Loc_u8Block = (u8*)Add_voidBlock;
+	u32 Loc_u32State;
+
+	if((Loc_u8Block < Add_structPool->Start) || (Loc_u8Block >= Add_structPool->End) ||
+	   ((u32)(Loc_u8Block - Add_structPool->Start) % Add_structPool->BlockSize))
+		return OS_POOL_INVALID_BLOCK;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidPoolFreeService(Add_structPool, Add_voidBlock);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_POOL_FREE, Add_structPool, Add_voidBlock, 0);
+	}
+	return OS_POOL_OK;
+}
+
+/** OS_u32PoolFreeBlocks
+ * @brief Returns the number of blocks currently free.
+ */
+u32 OS_u32PoolFreeBlocks(const OS_tstructPool* Add_structPool){
+	return Add_structPool->NoOfFree;
+}
+
+/** OS_u32PoolHighWaterMark
+ * @brief Returns the largest number of blocks ever allocated at the same time.
+ */
+u32 OS_u32PoolHighWaterMark(const OS_tstructPool* Add_structPool){
+	return Add_structPool->NoOfBlocks - Add_structPool->MinFree;
+}
@@ -4,8 +4,12 @@
 /* Version : V01                                          */
 /* Email   : mohamedhamiid20@gmail.com                    */
 /**********************************************************/
+#include <stddef.h>
+#include <string.h>
 #include "System.h"
 #include "Task.h"
+#include "Porting_CortexM.h"
+#include "MyRTOSConfig.h"
 #include "Mem_Management.h"
 
 /* Externed from startup code */
@@ -31,8 +35,13 @@ extern u32 _estack ;
  *    - PC: Sets the Program Counter to the task's function address.
  *    - LR: Sets the Link Register to 0xFFFFFFFD (indicating Thread mode with PSP).
  *    - R12, R3, R2, R1, R0, R4, R5, R6, R7, R8, R9, R10, R11: Sets these registers to 0.
+ *    - Cortex-M4F: EXC_RETURN 0xFFFFFFFD between R0 and R11, saved and restored by PendSV_Handler
+ *      (the first switch to a task restores no FPU context).
  * 3. The stack pointer (`CurrentPSP`) is decremented as values are pushed onto the stack.
- * 4. Returns `OS_OK` to indicate successful stack creation.
+ * 4. Fills the rest of the stack with `OS_STACK_PAINT_VALUE` if `OS_STACK_PAINT` is 1.
+ * 5. Writes `OS_STACK_CANARY_VALUE` at the lowest stack word (`_E_PSP_Task`).
+ *    With `OS_MPU_ENABLE`, also computes the MPU regions of the task (`OS_voidMpuTaskInit`).
+ * 6. Returns `OS_OK` to indicate successful stack creation.
  *
  * Example usage:
  * @code
@@ -80,10 +89,33 @@ OS_enumErrorStatus OS_enumCreateStack(OS_structTask* Add_structTask){
 	*(Add_structTask->CurrentPSP) = 0x0000000E;
 
 
-	for(u32 i=0 ; i<13 ; i++){
+	// R12, R3, R2, R1, R0
+	for(u32 i=0 ; i<5 ; i++){
 		Add_structTask->CurrentPSP--;
 		*(Add_structTask->CurrentPSP) = 0;
 	}
+#if OS_PORT == OS_PORT_CORTEX_M4F
+	// EXC_RETURN restored by PendSV_Handler: Thread mode, PSP, no FPU context yet (bit 4 set)
+	Add_structTask->CurrentPSP--;
+	*(Add_structTask->CurrentPSP) = 0xFFFFFFFD;
+#endif
+	// R11 -> R4
+	for(u32 i=0 ; i<8 ; i++){
+		Add_structTask->CurrentPSP--;
+		*(Add_structTask->CurrentPSP) = 0;
+	}
+
+#if OS_STACK_PAINT == 1
+	// Paint the unused part, OS_u32TaskStackHighWaterMark counts the words left untouched
+	for(pu32 Loc_pu32Word = (pu32)Add_structTask->_E_PSP_Task ; Loc_pu32Word < Add_structTask->CurrentPSP ; Loc_pu32Word++)
+		*Loc_pu32Word = OS_STACK_PAINT_VALUE;
+#endif
+	// Canary checked by PendSV_Handler, a task writing it has overflowed its stack
+	*(pu32)Add_structTask->_E_PSP_Task = OS_STACK_CANARY_VALUE;
+#if OS_MPU_ENABLE == 1
+	// Guard region below the stack, reprogrammed by PendSV_Handler
+	OS_voidMpuTaskInit(Add_structTask);
+#endif
 
 	return Error;
 }
@@ -103,7 +135,8 @@ OS_enumErrorStatus OS_enumCreateStack(OS_structTask* Add_structTask){
  *    from the start of the main stack.
  * 3. Ensures 8-byte alignment between the main stack and the first task's stack by setting `PSP_LastEnd` to the
  *    end of the main stack minus a padding value (`OS_STACK_PADDING`).
- * 4. Returns `OS_OK` to indicate successful main stack creation.
+ * 4. Sets the lowest address task stacks may use (`PSP_Limit`) `OS_PROCESS_STACK_SIZE` bytes below it.
+ * 5. Returns `OS_OK` to indicate successful main stack creation.
  *
  * Example usage:
  * @code
@@ -122,6 +155,505 @@ OS_enumErrorStatus OS_enumCreateMainStack(){
 	OS_StructOS._E_MSP_Task = OS_StructOS._S_MSP_Task - OS_MAIN_STACK_SIZE;
 	// Align 8 bytes between Main stack and first task
 	OS_StructOS.PSP_LastEnd = (OS_StructOS._E_MSP_Task-OS_STACK_PADDING);
+	OS_StructOS.PSP_Limit = OS_StructOS.PSP_LastEnd - OS_PROCESS_STACK_SIZE;
 
 	return error;
 }
+
+/* Free task stacks, one list per size class, linked through the lowest word of each stack */
+static u32 Global_u32StackFreeList[OS_STACK_NO_OF_CLASSES];
+/* Free stacks of the stack pool, kept apart so only OS_enumSpawnTask takes them. The pool is cut
+ * in one piece at init, [Low, High) tells a spawned task stack from a created task stack */
+static u32 Global_u32StackPoolFreeList[OS_STACK_NO_OF_CLASSES];
+static u32 Global_u32StackPoolLow, Global_u32StackPoolHigh;
+
+/* Cuts a new stack of Copy_u32Size bytes below PSP_LastEnd, returns its lowest address or 0
+ * if it does not fit above PSP_Limit */
+static u32 OS_u32StackCut(u32 Copy_u32Size){
+	u32 Loc_u32Stack;
+
+	if((OS_StructOS.PSP_LastEnd - OS_StructOS.PSP_Limit) < (Copy_u32Size + OS_STACK_PADDING))
+		return 0;
+	Loc_u32Stack = (OS_StructOS.PSP_LastEnd - Copy_u32Size) & ~(OS_STACK_ALIGNMENT - 1);
+	if(Loc_u32Stack < (OS_StructOS.PSP_Limit + OS_STACK_PADDING))
+		return 0;
+	// Align 8 bytes padding between the task and others
+	OS_StructOS.PSP_LastEnd = Loc_u32Stack - OS_STACK_PADDING;
+	return Loc_u32Stack;
+}
+
+/* Smallest size class holding Copy_u32Size bytes */
+static inline u32 OS_u32StackClass(u32 Copy_u32Size){
+	if(Copy_u32Size <= (1UL << OS_STACK_MIN_CLASS_LOG2))
+		return 0;
+	return (32 - __builtin_clz(Copy_u32Size - 1)) - OS_STACK_MIN_CLASS_LOG2;
+}
+
+/** OS_enumStackAlloc
+ * @brief Gives a task a stack of the size class of its `StackSize`.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Rounds `StackSize` up to its size class, sizes above the biggest class are refused.
+ * 2. Reuses the stack of a deleted created task of the same class if there is one (stacks of the
+ *    stack pool are kept for spawned tasks).
+ * 3. Otherwise cuts a new stack below `PSP_LastEnd` (aligned to `OS_STACK_ALIGNMENT`), after
+ *    checking it stays above `PSP_Limit`.
+ * 4. Sets `_S_PSP_Task` (top, exclusive) and `_E_PSP_Task` (bottom) of the task.
+ */
+OS_enumErrorStatus OS_enumStackAlloc(OS_structTask* Add_structTask){
+	u32 Loc_u32Class, Loc_u32Size;
+
+	if(!Add_structTask->StackSize || (Add_structTask->StackSize > (1UL << OS_STACK_MAX_CLASS_LOG2)))
+		return OS_EXCEED_AVAILABLE_STACK;
+
+	Loc_u32Class = OS_u32StackClass(Add_structTask->StackSize);
+	Loc_u32Size = 1UL << (Loc_u32Class + OS_STACK_MIN_CLASS_LOG2);
+
+	if(Global_u32StackFreeList[Loc_u32Class]){
+		Add_structTask->_E_PSP_Task = Global_u32StackFreeList[Loc_u32Class];
+		Global_u32StackFreeList[Loc_u32Class] = *(pu32)Add_structTask->_E_PSP_Task;
+	}
+	else{
+		Add_structTask->_E_PSP_Task = OS_u32StackCut(Loc_u32Size);
+		if(!Add_structTask->_E_PSP_Task)
+			return OS_EXCEED_AVAILABLE_STACK;
+	}
+	Add_structTask->_S_PSP_Task = Add_structTask->_E_PSP_Task + Loc_u32Size;
+
+	return OS_OK;
+}
+
+/** OS_enumStackPoolAlloc
+ * @brief Gives a spawned task a stack of the stack pool, of the size class of its `StackSize`.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Refuses sizes above the biggest class.
+ * 2. Pops a stack from the pool free list of the class, it never cuts the process stack region,
+ *    so an empty list returns OS_EXCEED_AVAILABLE_STACK.
+ * 3. Sets `_S_PSP_Task` (top, exclusive) and `_E_PSP_Task` (bottom) of the task.
+ */
+OS_enumErrorStatus OS_enumStackPoolAlloc(OS_structTask* Add_structTask){
+	u32 Loc_u32Class;
+
+	if(!Add_structTask->StackSize || (Add_structTask->StackSize > (1UL << OS_STACK_MAX_CLASS_LOG2)))
+		return OS_EXCEED_AVAILABLE_STACK;
+
+	Loc_u32Class = OS_u32StackClass(Add_structTask->StackSize);
+	if(!Global_u32StackPoolFreeList[Loc_u32Class])
+		return OS_EXCEED_AVAILABLE_STACK;
+	Add_structTask->_E_PSP_Task = Global_u32StackPoolFreeList[Loc_u32Class];
+	Global_u32StackPoolFreeList[Loc_u32Class] = *(pu32)Add_structTask->_E_PSP_Task;
+	Add_structTask->_S_PSP_Task = Add_structTask->_E_PSP_Task + (1UL << (Loc_u32Class + OS_STACK_MIN_CLASS_LOG2));
+
+	return OS_OK;
+}
+
+/** OS_voidStackFree
+ * @brief Gives the stack of a deleted task back to the free list of its size class, the stack
+ *        pool one if it was cut by `OS_enumStackPoolInit`.
+ */
+void OS_voidStackFree(OS_structTask* Add_structTask){
+	u32 Loc_u32Class = OS_u32StackClass(Add_structTask->_S_PSP_Task - Add_structTask->_E_PSP_Task);
+	u32* Loc_pu32FreeList = Global_u32StackFreeList;
+
+	if((Add_structTask->_E_PSP_Task >= Global_u32StackPoolLow) && (Add_structTask->_E_PSP_Task < Global_u32StackPoolHigh))
+		Loc_pu32FreeList = Global_u32StackPoolFreeList;
+	*(pu32)Add_structTask->_E_PSP_Task = Loc_pu32FreeList[Loc_u32Class];
+	Loc_pu32FreeList[Loc_u32Class] = Add_structTask->_E_PSP_Task;
+	Add_structTask->_S_PSP_Task = 0;
+	Add_structTask->_E_PSP_Task = 0;
+}
+
+/** OS_u32TaskStackHighWaterMark
+ * @brief Returns the smallest number of stack bytes a task ever had left.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Returns 0 if the canary word at the bottom of the task stack was overwritten (without MPU).
+ * 2. Starts above the guard (`OS_STACK_GUARD_SIZE` bytes: the canary word, or the MPU guard region).
+ * 3. Counts the words still holding `OS_STACK_PAINT_VALUE`, stopping at the first written one.
+ *    The scan is read only, it runs in Thread Mode and may be called for any task.
+ */
+u32 OS_u32TaskStackHighWaterMark(OS_structTask* Add_structTask){
+	pu32 Loc_pu32Word = (pu32)Add_structTask->_E_PSP_Task;
+	pu32 Loc_pu32Top = (pu32)Add_structTask->_S_PSP_Task;
+
+	if(!Loc_pu32Word)
+		return 0;
+#if OS_MPU_ENABLE == 0
+	if(*Loc_pu32Word != OS_STACK_CANARY_VALUE)
+		return 0;
+#endif
+	// The guard cannot be read by tasks, the MPU stops them before they write it
+	Loc_pu32Word += OS_STACK_GUARD_SIZE / sizeof(u32);
+	while((Loc_pu32Word < Loc_pu32Top) && (*Loc_pu32Word == OS_STACK_PAINT_VALUE))
+		Loc_pu32Word++;
+	return (u32)Loc_pu32Word - Add_structTask->_E_PSP_Task - OS_STACK_GUARD_SIZE;
+}
+
+/** OS_enumStackPoolInit
+ * @brief Cuts the stacks of the stack pool below `PSP_LastEnd` and links them in the pool free
+ *        lists, which only `OS_enumStackPoolAlloc` pops.
+ */
+OS_enumErrorStatus OS_enumStackPoolInit(){
+	const u8 Loc_u8Blocks[OS_STACK_NO_OF_CLASSES] = OS_STACK_POOL_BLOCKS;
+	u32 Loc_u32Size, Loc_u32Stack;
+
+	// Stacks are cut downwards one after the other, the pool ends at the current PSP_LastEnd
+	Global_u32StackPoolHigh = OS_StructOS.PSP_LastEnd;
+	Global_u32StackPoolLow = Global_u32StackPoolHigh;
+	for(u32 Loc_u32Class = 0 ; Loc_u32Class < OS_STACK_NO_OF_CLASSES ; Loc_u32Class++){
+		Loc_u32Size = 1UL << (Loc_u32Class + OS_STACK_MIN_CLASS_LOG2);
+		for(u32 i = 0 ; i < Loc_u8Blocks[Loc_u32Class] ; i++){
+			Loc_u32Stack = OS_u32StackCut(Loc_u32Size);
+			if(!Loc_u32Stack)
+				return OS_EXCEED_AVAILABLE_STACK;
+			Global_u32StackPoolLow = Loc_u32Stack;
+			*(pu32)Loc_u32Stack = Global_u32StackPoolFreeList[Loc_u32Class];
+			Global_u32StackPoolFreeList[Loc_u32Class] = Loc_u32Stack;
+		}
+	}
+	return OS_OK;
+}
+
+/* Two Level Segregated Fit (TLSF) heap
+ * Free blocks are kept in FL x SL lists: the first level splits sizes in powers of two and
+ * the second level splits each power of two in OS_HEAP_SL_COUNT linear ranges. Two bitmaps
+ * tell which lists are not empty, so a fitting list is found with two bit scans and both
+ * allocation and free take a bounded number of steps whatever the heap state. */
+#define OS_HEAP_ALIGN_LOG2     3
+#define OS_HEAP_ALIGN          (1UL << OS_HEAP_ALIGN_LOG2)
+#define OS_HEAP_SL_LOG2        4
+#define OS_HEAP_SL_COUNT       (1UL << OS_HEAP_SL_LOG2)
+#define OS_HEAP_FL_SHIFT       (OS_HEAP_SL_LOG2 + OS_HEAP_ALIGN_LOG2)
+#define OS_HEAP_SMALL_BLOCK    (1UL << OS_HEAP_FL_SHIFT)                    // Sizes below are in first level 0
+#define OS_HEAP_FL_COUNT       (OS_HEAP_FL_MAX_LOG2 - OS_HEAP_FL_SHIFT + 1)
+#define OS_HEAP_BLOCK_MAX      ((1UL << OS_HEAP_FL_MAX_LOG2) - OS_HEAP_ALIGN)
+
+#define OS_HEAP_BLOCK_FREE     1UL                                          // Flag in the low bits of Size
+
+/* Block header, the payload starts at NextFree: the free list links only exist while the block is free */
+typedef struct OS_structHeapBlockTag{
+	struct OS_structHeapBlockTag* PrevPhys;  // Block just before in memory (NULL for the first one of a region)
+	u32 Size;                                // Payload size in bytes | OS_HEAP_BLOCK_FREE
+	struct OS_structHeapBlockTag* NextFree;
+	struct OS_structHeapBlockTag* PrevFree;
+}OS_tstructHeapBlock;
+
+#define OS_HEAP_HEADER_SIZE    (offsetof(OS_tstructHeapBlock, NextFree))
+#define OS_HEAP_ROUND_UP(x)    (((x) + OS_HEAP_ALIGN - 1) & ~(OS_HEAP_ALIGN - 1))
+#define OS_HEAP_MIN_PAYLOAD    OS_HEAP_ROUND_UP(sizeof(OS_tstructHeapBlock) - OS_HEAP_HEADER_SIZE)
+
+typedef struct{
+	u32 FLBitmap;                                                    // Bit f set when SLBitmap[f] != 0
+	u32 SLBitmap[OS_HEAP_FL_COUNT];                                  // Bit s set when FreeLists[f][s] != NULL
+	OS_tstructHeapBlock* FreeLists[OS_HEAP_FL_COUNT][OS_HEAP_SL_COUNT];
+	u32 TotalBytes;                                                  // Payload bytes of all regions
+	u32 FreeBytes;                                                   // Payload bytes of the free blocks
+	u32 MinFreeBytes;                                                // Lowest FreeBytes ever reached
+}OS_tstructHeap;
+
+static OS_tstructHeap Global_structHeap;
+#if OS_HEAP_SIZE > 0
+static u32 Global_u32HeapRegion[OS_HEAP_SIZE / sizeof(u32)] __attribute__((aligned(8)));
+#endif
+
+static inline u32 OS_u32HeapBlockSize(const OS_tstructHeapBlock* Add_structBlock){
+	return Add_structBlock->Size & ~(OS_HEAP_ALIGN - 1);
+}
+
+static inline OS_tstructHeapBlock* OS_structHeapNextPhys(const OS_tstructHeapBlock* Add_structBlock){
+	return (OS_tstructHeapBlock*)((u8*)Add_structBlock + OS_HEAP_HEADER_SIZE + OS_u32HeapBlockSize(Add_structBlock));
+}
+
+/* Finds the lists a block of this size belongs to */
+static inline void OS_voidHeapMapping(u32 Copy_u32Size, u32* Add_u32FL, u32* Add_u32SL){
+	u32 Loc_u32Msb;
+
+	if(Copy_u32Size < OS_HEAP_SMALL_BLOCK){
+		*Add_u32FL = 0;
+		*Add_u32SL = Copy_u32Size / (OS_HEAP_SMALL_BLOCK / OS_HEAP_SL_COUNT);
+	}
+	else{
+		Loc_u32Msb = 31 - __builtin_clz(Copy_u32Size);
+		*Add_u32SL = (Copy_u32Size >> (Loc_u32Msb - OS_HEAP_SL_LOG2)) ^ OS_HEAP_SL_COUNT;
+		*Add_u32FL = Loc_u32Msb - (OS_HEAP_FL_SHIFT - 1);
+	}
+}
+
+static void OS_voidHeapInsert(OS_tstructHeapBlock* Add_structBlock){
+	u32 Loc_u32FL, Loc_u32SL;
+	OS_tstructHeapBlock* Loc_structHead;
+
+	OS_voidHeapMapping(OS_u32HeapBlockSize(Add_structBlock), &Loc_u32FL, &Loc_u32SL);
+	Loc_structHead = Global_structHeap.FreeLists[Loc_u32FL][Loc_u32SL];
+
+	Add_structBlock->Size |= OS_HEAP_BLOCK_FREE;
+	Add_structBlock->PrevFree = NULL;
+	Add_structBlock->NextFree = Loc_structHead;
+	if(Loc_structHead)
+		Loc_structHead->PrevFree = Add_structBlock;
+	Global_structHeap.FreeLists[Loc_u32FL][Loc_u32SL] = Add_structBlock;
+
+	Global_structHeap.FLBitmap |= 1UL << Loc_u32FL;
+	Global_structHeap.SLBitmap[Loc_u32FL] |= 1UL << Loc_u32SL;
+	Global_structHeap.FreeBytes += OS_u32HeapBlockSize(Add_structBlock);
+}
+
+static void OS_voidHeapRemove(OS_tstructHeapBlock* Add_structBlock){
+	u32 Loc_u32FL, Loc_u32SL;
+
+	OS_voidHeapMapping(OS_u32HeapBlockSize(Add_structBlock), &Loc_u32FL, &Loc_u32SL);
+
+	if(Add_structBlock->NextFree)
+		Add_structBlock->NextFree->PrevFree = Add_structBlock->PrevFree;
+	if(Add_structBlock->PrevFree)
+		Add_structBlock->PrevFree->NextFree = Add_structBlock->NextFree;
+	else{
+		Global_structHeap.FreeLists[Loc_u32FL][Loc_u32SL] = Add_structBlock->NextFree;
+		if(!Add_structBlock->NextFree){
+			Global_structHeap.SLBitmap[Loc_u32FL] &= ~(1UL << Loc_u32SL);
+			if(!Global_structHeap.SLBitmap[Loc_u32FL])
+				Global_structHeap.FLBitmap &= ~(1UL << Loc_u32FL);
+		}
+	}
+
+	Add_structBlock->Size &= ~OS_HEAP_BLOCK_FREE;
+	Global_structHeap.FreeBytes -= OS_u32HeapBlockSize(Add_structBlock);
+}
+
+/** OS_enumHeapAddRegion
+ * @brief Gives a memory region to the heap.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Aligns the region bounds to 8 bytes and checks one block and the end marker fit.
+ * 2. Cuts the region in free blocks of at most OS_HEAP_BLOCK_MAX bytes and inserts them.
+ * 3. Closes the region with a used block of size 0, so merging never crosses its end.
+ * 4. Adds the free bytes of the region to the lowest free bytes ever reached.
+ */
+OS_enumErrorStatus OS_enumHeapAddRegion(void* Add_voidRegion, u32 Copy_u32Size){
+	u8* Loc_u8Start = (u8*)OS_HEAP_ROUND_UP((u32)Add_voidRegion);
+	u8* Loc_u8End = (u8*)(((u32)Add_voidRegion + Copy_u32Size) & ~(OS_HEAP_ALIGN - 1));
+	OS_tstructHeapBlock* Loc_structPrev = NULL;
+	OS_tstructHeapBlock* Loc_structBlock = (OS_tstructHeapBlock*)Loc_u8Start;
+	u32 Loc_u32Available, Loc_u32Payload, Loc_u32FreeBefore;
+	u32 Loc_u32State;
+
+	if(!Add_voidRegion || (Loc_u8End <= Loc_u8Start) ||
+	   ((u32)(Loc_u8End - Loc_u8Start) < (2 * OS_HEAP_HEADER_SIZE) + OS_HEAP_MIN_PAYLOAD))
+		return HEAP_INIT_ERROR;
+
+	OS_ENTER_CRITICAL(Loc_u32State);
+	Loc_u32FreeBefore = Global_structHeap.FreeBytes;
+	Loc_u32Available = (u32)(Loc_u8End - Loc_u8Start) - OS_HEAP_HEADER_SIZE;
+	while(Loc_u32Available >= OS_HEAP_HEADER_SIZE + OS_HEAP_MIN_PAYLOAD){
+		Loc_u32Payload = Loc_u32Available - OS_HEAP_HEADER_SIZE;
+		if(Loc_u32Payload > OS_HEAP_BLOCK_MAX)
+			Loc_u32Payload = OS_HEAP_BLOCK_MAX;
+
+		Loc_structBlock->PrevPhys = Loc_structPrev;
+		Loc_structBlock->Size = Loc_u32Payload;
+		OS_voidHeapInsert(Loc_structBlock);
+		Global_structHeap.TotalBytes += Loc_u32Payload;
+
+		Loc_structPrev = Loc_structBlock;
+		Loc_structBlock = OS_structHeapNextPhys(Loc_structBlock);
+		Loc_u32Available -= OS_HEAP_HEADER_SIZE + Loc_u32Payload;
+	}
+	Loc_structBlock->PrevPhys = Loc_structPrev;
+	Loc_structBlock->Size = 0;
+	// The low-water mark keeps its history, the new region only raises it by its own bytes
+	Global_structHeap.MinFreeBytes += Global_structHeap.FreeBytes - Loc_u32FreeBefore;
+	OS_EXIT_CRITICAL(Loc_u32State);
+
+	return OS_OK;
+}
+
+/** OS_enumHeapInit
+ * @brief Empties the heap then adds the default region of OS_HEAP_SIZE bytes.
+ */
+OS_enumErrorStatus OS_enumHeapInit(){
+	memset(&Global_structHeap, 0, sizeof(Global_structHeap));
+#if OS_HEAP_SIZE > 0
+	return OS_enumHeapAddRegion(Global_u32HeapRegion, sizeof(Global_u32HeapRegion));
+#else
+	return OS_OK;
+#endif
+}
+
+/** OS_pvHeapAllocService
+ * @brief Allocates a block in bounded time, runs in Handler Mode.
+ *
+ * @details
+ * 1. Rounds the size up to 8 bytes, then up to the next second level range so every block of
+ *    the list found is big enough (good fit instead of best fit, no list walk).
+ * 2. Finds the first non empty list at or above it with the two bitmaps.
+ * 3. Takes the head block and gives the unused tail back to the free lists if it can hold a block.
+ */
+void* OS_pvHeapAllocService(u32 Copy_u32Size){
+	u32 Loc_u32Size, Loc_u32Search, Loc_u32FL, Loc_u32SL, Loc_u32Map;
+	OS_tstructHeapBlock* Loc_structBlock;
+	OS_tstructHeapBlock* Loc_structRemainder;
+
+	if(!Copy_u32Size || (Copy_u32Size > OS_HEAP_BLOCK_MAX))
+		return NULL;
+
+	Loc_u32Size = OS_HEAP_ROUND_UP(Copy_u32Size);
+	if(Loc_u32Size < OS_HEAP_MIN_PAYLOAD)
+		Loc_u32Size = OS_HEAP_MIN_PAYLOAD;
+
+	Loc_u32Search = Loc_u32Size;
+	if(Loc_u32Search >= OS_HEAP_SMALL_BLOCK)
+		Loc_u32Search += (1UL << ((31 - __builtin_clz(Loc_u32Search)) - OS_HEAP_SL_LOG2)) - 1;
+	OS_voidHeapMapping(Loc_u32Search, &Loc_u32FL, &Loc_u32SL);
+	if(Loc_u32FL >= OS_HEAP_FL_COUNT)
+		return NULL;
+
+	Loc_u32Map = Global_structHeap.SLBitmap[Loc_u32FL] & (~0UL << Loc_u32SL);
+	if(!Loc_u32Map){
+		Loc_u32Map = (Loc_u32FL + 1 < 32) ? (Global_structHeap.FLBitmap & (~0UL << (Loc_u32FL + 1))) : 0;
+		if(!Loc_u32Map)
+			return NULL;
+		Loc_u32FL = __builtin_ctz(Loc_u32Map);
+		Loc_u32Map = Global_structHeap.SLBitmap[Loc_u32FL];
+	}
+	Loc_u32SL = __builtin_ctz(Loc_u32Map);
+
+	Loc_structBlock = Global_structHeap.FreeLists[Loc_u32FL][Loc_u32SL];
+	OS_voidHeapRemove(Loc_structBlock);
+
+	if(OS_u32HeapBlockSize(Loc_structBlock) >= Loc_u32Size + OS_HEAP_HEADER_SIZE + OS_HEAP_MIN_PAYLOAD){
+		Loc_structRemainder = (OS_tstructHeapBlock*)((u8*)Loc_structBlock + OS_HEAP_HEADER_SIZE + Loc_u32Size);
+		Loc_structRemainder->PrevPhys = Loc_structBlock;
+		Loc_structRemainder->Size = OS_u32HeapBlockSize(Loc_structBlock) - Loc_u32Size - OS_HEAP_HEADER_SIZE;
+		OS_structHeapNextPhys(Loc_structRemainder)->PrevPhys = Loc_structRemainder;
+		Loc_structBlock->Size = Loc_u32Size;
+		OS_voidHeapInsert(Loc_structRemainder);
+	}
+
+	if(Global_structHeap.FreeBytes < Global_structHeap.MinFreeBytes)
+		Global_structHeap.MinFreeBytes = Global_structHeap.FreeBytes;
+
+	return &Loc_structBlock->NextFree;
+}
+
+/** OS_voidHeapFreeService
+ * @brief Frees a block in bounded time, runs in Handler Mode.
+ *
+ * @details
+ * 1. Merges the block with the block before it in memory if that one is free.
+ * 2. Merges the result with the block after it in memory if that one is free.
+ * 3. Inserts the merged block in its list. A merge never makes a block bigger than
+ *    OS_HEAP_BLOCK_MAX, so every free block keeps a valid list.
+ */
+void OS_voidHeapFreeService(void* Add_voidBlock){
+	OS_tstructHeapBlock* Loc_structBlock;
+	OS_tstructHeapBlock* Loc_structNeighbour;
+
+	if(!Add_voidBlock)
+		return;
+
+	Loc_structBlock = (OS_tstructHeapBlock*)((u8*)Add_voidBlock - OS_HEAP_HEADER_SIZE);
+	if(Loc_structBlock->Size & OS_HEAP_BLOCK_FREE)
+		return; // Double free
+
+	Loc_structNeighbour = Loc_structBlock->PrevPhys;
+	if(Loc_structNeighbour && (Loc_structNeighbour->Size & OS_HEAP_BLOCK_FREE) &&
+	   (OS_u32HeapBlockSize(Loc_structNeighbour) + OS_HEAP_HEADER_SIZE + OS_u32HeapBlockSize(Loc_structBlock) <= OS_HEAP_BLOCK_MAX)){
+		OS_voidHeapRemove(Loc_structNeighbour);
+		Loc_structNeighbour->Size += OS_HEAP_HEADER_SIZE + OS_u32HeapBlockSize(Loc_structBlock);
+		Loc_structBlock = Loc_structNeighbour;
+		OS_structHeapNextPhys(Loc_structBlock)->PrevPhys = Loc_structBlock;
+	}
+
+	Loc_structNeighbour = OS_structHeapNextPhys(Loc_structBlock);
+	if((Loc_structNeighbour->Size & OS_HEAP_BLOCK_FREE) &&
+	   (OS_u32HeapBlockSize(Loc_structBlock) + OS_HEAP_HEADER_SIZE + OS_u32HeapBlockSize(Loc_structNeighbour) <= OS_HEAP_BLOCK_MAX)){
+		OS_voidHeapRemove(Loc_structNeighbour);
+		Loc_structBlock->Size += OS_HEAP_HEADER_SIZE + OS_u32HeapBlockSize(Loc_structNeighbour);
+		OS_structHeapNextPhys(Loc_structBlock)->PrevPhys = Loc_structBlock;
+	}
+
+	OS_voidHeapInsert(Loc_structBlock);
+}
+
+/** OS_voidHeapStatsService
+ * @brief Fills the heap statistics, runs in Handler Mode.
+ *
+ * The largest free block is in the highest non empty list, only that list is walked.
+ */
+void OS_voidHeapStatsService(OS_tstructHeapStats* Add_structStats){
+	OS_tstructHeapBlock* Loc_structBlock;
+	u32 Loc_u32FL, Loc_u32Largest = 0;
+
+	if(Global_structHeap.FLBitmap){
+		Loc_u32FL = 31 - __builtin_clz(Global_structHeap.FLBitmap);
+		Loc_structBlock = Global_structHeap.FreeLists[Loc_u32FL][31 - __builtin_clz(Global_structHeap.SLBitmap[Loc_u32FL])];
+		for( ; Loc_structBlock ; Loc_structBlock = Loc_structBlock->NextFree)
+			if(OS_u32HeapBlockSize(Loc_structBlock) > Loc_u32Largest)
+				Loc_u32Largest = OS_u32HeapBlockSize(Loc_structBlock);
+	}
+
+	Add_structStats->TotalBytes = Global_structHeap.TotalBytes;
+	Add_structStats->FreeBytes = Global_structHeap.FreeBytes;
+	Add_structStats->MinEverFreeBytes = Global_structHeap.MinFreeBytes;
+	Add_structStats->LargestFreeBlock = Loc_u32Largest;
+	Add_structStats->FragmentationPercent = Global_structHeap.FreeBytes ?
+			100 - ((Loc_u32Largest * 100) / Global_structHeap.FreeBytes) : 0;
+}
+
+/** OS_pvMalloc
+ * @brief Allocates `Copy_u32Size` bytes from the heap.
+ *
+ * From an ISR the heap is accessed with interrupts masked, from a task the call goes through
+ * SVC_HEAP_ALLOC so the scheduler and ISRs never see the heap half updated.
+ */
+void* OS_pvMalloc(u32 Copy_u32Size){
+	void* Loc_pvBlock = NULL;
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		Loc_pvBlock = OS_pvHeapAllocService(Copy_u32Size);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_HEAP_ALLOC, Copy_u32Size, &Loc_pvBlock, 0);
+	}
+	return Loc_pvBlock;
+}
+
+/** OS_voidFree
+ * @brief Gives a block returned by OS_pvMalloc back to the heap.
+ */
+void OS_voidFree(void* Add_voidBlock){
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidHeapFreeService(Add_voidBlock);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_HEAP_FREE, Add_voidBlock, 0, 0);
+	}
+}
+
+/** OS_voidHeapGetStats
+ * @brief Reads the heap statistics.
+ */
+void OS_voidHeapGetStats(OS_tstructHeapStats* Add_structStats){
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidHeapStatsService(Add_structStats);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_HEAP_STATS, Add_structStats, 0, 0);
+	}
+}
@@ -0,0 +1,118 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Zero-copy ping-pong (N buffers) handoff from a DMA */
+/*           interrupt to one consumer task                     */
+/****************************************************************/
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "PingPong.h"
+
+/** OS_enumPingPongCreate
+ * @brief Initializes a ping-pong object over the DMA target memory.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Checks the memory is not NULL, the buffer size is not 0 and there are at least 2 buffers.
+ * 2. Resets the indices, the overrun count and the consumer wait list.
+ */
+OS_tenuPingPongState OS_enumPingPongCreate(OS_tstructPingPong* Add_structPingPong, u8* Add_u8Buffers, u32 Copy_u32BufferSize, u32 Copy_u32NoOfBuffers){
+	if(!Add_u8Buffers || !Copy_u32BufferSize || (Copy_u32NoOfBuffers < 2))
+		return OS_PINGPONG_INIT_ERROR;
+
+	Add_structPingPong->Buffers = Add_u8Buffers;
+	Add_structPingPong->BufferSize = Copy_u32BufferSize;
+	Add_structPingPong->NoOfBuffers = Copy_u32NoOfBuffers;
+	Add_structPingPong->FillIndex = 0;
+	Add_structPingPong->OverrunCount = 0;
+	Add_structPingPong->ReadIndex = 0;
+	Add_structPingPong->BorrowedIndex = 0;
+	Add_structPingPong->ConsumerWaitList = NULL;
+
+	return OS_PINGPONG_INIT_OK;
+}
+
+/** OS_voidPingPongBufferFilledFromISR
+ * @brief Hands the buffer the DMA just finished over to the consumer.
+ *
+ * @details
+ * 1. FillIndex is advanced, the DMA is now writing buffer (FillIndex % NoOfBuffers).
+ * 2. If that buffer was not released yet (NoOfBuffers buffers pending) an overrun is counted.
+ * 3. A blocked consumer is popped from the wait list and made ready with OS_MarkTaskReady,
+ *    the switch happens when the ISR returns if the consumer has a higher priority.
+ */
+void OS_voidPingPongBufferFilledFromISR(OS_tstructPingPong* Add_structPingPong){
+	__DMB();
+	Add_structPingPong->FillIndex++;
+	if((Add_structPingPong->FillIndex - Add_structPingPong->ReadIndex) >= Add_structPingPong->NoOfBuffers)
+		Add_structPingPong->OverrunCount++;
+	__DMB();
+
+	if(Add_structPingPong->ConsumerWaitList)
+		OS_voidWakeWaitListFromISR((OS_structTask**)&Add_structPingPong->ConsumerWaitList);
+}
+
+/** OS_enumPingPongBorrow
+ * @brief Gives the consumer the oldest filled buffer in place, without copying it.
+ *
+ * @details
+ * 1. If no buffer is filled and the caller may wait, SVC_PINGPONG_WAIT blocks it.
+ * 2. If NoOfBuffers buffers are pending the oldest is being overwritten, the read index jumps
+ *    to the oldest complete buffer and OS_PINGPONG_OVERRUN is returned.
+ * 3. The buffer address is computed from the read index, nothing is copied.
+ */
+OS_tenuPingPongState OS_enumPingPongBorrow(OS_tstructPingPong* Add_structPingPong, void** Add_pvBuffer, u32 Copy_u32TicksToWait){
+	OS_tenuPingPongState Loc_enumState = OS_PINGPONG_OK;
+	u32 Loc_u32Fill;
+
+	if((Add_structPingPong->FillIndex == Add_structPingPong->ReadIndex) && Copy_u32TicksToWait)
+		OS_REQUEST_SERVICE_ARGS(SVC_PINGPONG_WAIT, Add_structPingPong, Copy_u32TicksToWait, 0);
+
+	Loc_u32Fill = Add_structPingPong->FillIndex;
+	__DMB();
+	if(Loc_u32Fill == Add_structPingPong->ReadIndex)
+		return OS_PINGPONG_EMPTY;
+
+	if((Loc_u32Fill - Add_structPingPong->ReadIndex) >= Add_structPingPong->NoOfBuffers){
+		Add_structPingPong->ReadIndex = Loc_u32Fill - (Add_structPingPong->NoOfBuffers - 1);
+		Loc_enumState = OS_PINGPONG_OVERRUN;
+	}
+
+	Add_structPingPong->BorrowedIndex = Add_structPingPong->ReadIndex;
+	*Add_pvBuffer = &Add_structPingPong->Buffers[(Add_structPingPong->BorrowedIndex % Add_structPingPong->NoOfBuffers) * Add_structPingPong->BufferSize];
+
+	return Loc_enumState;
+}
+
+/** OS_enumPingPongRelease
+ * @brief Gives the borrowed buffer back to the DMA.
+ *
+ * The DMA starts overwriting the borrowed buffer once FillIndex reaches
+ * BorrowedIndex + NoOfBuffers, this is checked before the buffer is given back.
+ */
+OS_tenuPingPongState OS_enumPingPongRelease(OS_tstructPingPong* Add_structPingPong){
+	OS_tenuPingPongState Loc_enumState = OS_PINGPONG_OK;
+
+	__DMB();
+	if((Add_structPingPong->FillIndex - Add_structPingPong->BorrowedIndex) >= Add_structPingPong->NoOfBuffers)
+		Loc_enumState = OS_PINGPONG_OVERRUN;
+	Add_structPingPong->ReadIndex = Add_structPingPong->BorrowedIndex + 1;
+
+	return Loc_enumState;
+}
+
+/** OS_voidPingPongWaitService
+ * @brief Kernel side of the blocking borrow, runs in Handler Mode.
+ *
+ * FillIndex is checked again with interrupts masked so a buffer filled between the
+ * task's check and the SVC is not missed.
+ */
+void OS_voidPingPongWaitService(OS_tstructPingPong* Add_structPingPong, u32 Copy_u32TicksToWait){
+	if(Add_structPingPong->FillIndex == Add_structPingPong->ReadIndex)
+		OS_voidBlockCurrentTask((OS_structTask**)&Add_structPingPong->ConsumerWaitList, Copy_u32TicksToWait);
+}
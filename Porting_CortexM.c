@@ -3,13 +3,16 @@
 /* Date    : 7 / 6 / 2024                             	        */
 /* Version : V01                                                */
 /* Email   : mohamedhamiid20@gmail.com                          */
-/* Brief   : Handling Ports according to STM32F1 ARM CortexM3   */
+/* Brief   : Handling Ports according to ARM CortexM3 / M4F      */
 /****************************************************************/
 #include "Task.h"
 #include "System.h"
 #include "Scheduler.h"
 #include "Porting_CortexM.h"
 #include "MyRTOSConfig.h"
+#include "Mem_Management.h"
+
+#if (OS_PORT == OS_PORT_CORTEX_M3) || (OS_PORT == OS_PORT_CORTEX_M4F)
 
 /* Variable for ticker checking */
 uint8_t Global_u8SystickLed;
@@ -48,6 +51,14 @@ void HardFault_Handler(void)
 void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
+#if OS_MPU_ENABLE == 1
+  /* Fault while stacking an exception frame, or access to the stack guard: stack overflow */
+  OS_structTask* Loc_structTask = OS_StructOS.CurrentTask;
+  u32 Loc_u32Cfsr = SCB->CFSR;
+  if((Loc_u32Cfsr & SCB_CFSR_MSTKERR_Msk) ||
+     ((Loc_u32Cfsr & SCB_CFSR_MMARVALID_Msk) && ((SCB->MMFAR - Loc_structTask->_E_PSP_Task) < OS_STACK_GUARD_SIZE)))
+    OS_voidStackOverflowHook(Loc_structTask);
+#endif
 
   /* USER CODE END MemoryManagement_IRQn 0 */
   while (1)
@@ -86,20 +97,18 @@ void UsageFault_Handler(void)
     /* USER CODE END W1_UsageFault_IRQn 0 */
   }
 }
-extern u8 Global_u8Scheduler;
 void SysTick_Handler(void)
 {
+	u32 Loc_u32State;
 	/* For Testing */
 	Global_u8SystickLed ^= 1;
+	/* ISRs may wake tasks too */
+	OS_ENTER_CRITICAL(Loc_u32State);
 	/* Update Number of Ticks */
 	OS_enumUpdateNoOfTicks();
-	Global_u8Scheduler ^=1;
-	/* Decide Current and Next task */
-	OS_voidDecideNext();
-	Global_u8Scheduler ^=1;
-	/* Trigger PendSV for switch context */
-	if(OS_StructOS.NextTask && OS_StructOS.NextTask != OS_StructOS.CurrentTask)
-		OS_TRIGGER_PENDSV();
+	/* Decide Current and Next task and trigger PendSV, deferred while the scheduler is locked */
+	OS_voidSchedule();
+	OS_EXIT_CRITICAL(Loc_u32State);
 }
 
 /* SVC Handler */
@@ -140,6 +149,15 @@ void OS_voidHwInit(){
 	/* Decrease PendSV priority to be equal to Systick Priority */
 	__NVIC_SetPriority(PendSV_IRQn,15);
 
+#if OS_PORT == OS_PORT_CORTEX_M4F
+	/* Full access to the FPU (CP10, CP11) */
+	SCB->CPACR |= (0xFUL << 20);
+	/* Automatic and lazy state preservation: the exception frame reserves S0-S15 and FPSCR
+	 * but they are only saved if the handler uses the FPU (or PendSV saves the task) */
+	FPU->FPCCR |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk;
+	__DSB();
+	__ISB();
+#endif
 }
 void OS_voidStartTimer(){
 	/* By default:
@@ -164,11 +182,19 @@ void OS_voidStartTimer(){
  * 2. Saves the current task's context:
  *    - Gets the current Process Stack Pointer (PSP) and updates the task structure.
  *    - Manually pushes the registers R4 to R11 onto the stack.
+ *    - Cortex-M4F (`OS_PORT_CORTEX_M4F`): also pushes EXC_RETURN, and S16 to S31 only when its bit 4
+ *      is clear (the task used the FPU). That store triggers the lazy stacking of S0 to S15 in the
+ *      space the hardware reserved, integer only tasks keep the Cortex-M3 switch cost.
+ *    - If `OS_STACK_CHECK` is 1, branches to `OS_voidStackOverflowHook` when the saved PSP reached
+ *      the bottom of the task stack or the canary word there was overwritten.
  * 3. Switches to the next task:
  *    - Sets the current task to the next task.
+ *    - If `OS_MPU_ENABLE` is 1, copies the three precomputed RBAR / RASR pairs of the next task to
+ *      the MPU RBAR / RASR registers and their aliases with a single load and store multiple.
  *    - Clears the next task pointer.
  * 4. Restores the next task's context:
- *    - Manually restores the registers R4 to R11 from the stack.
+ *    - Manually restores the registers R4 to R11 from the stack (and EXC_RETURN, S16 to S31 on
+ *      Cortex-M4F, the returned EXC_RETURN tells the hardware which frame type to unstack).
  *    - Sets the PSP to the next task's PSP.
  * 5. Branches to the link register (LR) to exit the handler.
  */
@@ -215,18 +241,51 @@ __attribute__((naked)) void PendSV_Handler(void) {
         "   LDR     R2, [R3, #0]                \n" // Load address of CurrentTask (Offset 20 in OS_StructOS)
 
         // Save context of the current task
+#if OS_PORT == OS_PORT_CORTEX_M4F
+        "   TST     LR, #0x10                   \n" // EXC_RETURN bit 4 clear: the task used the FPU
+        "   IT      EQ                          \n"
+        "   VSTMDBEQ R0!, {S16-S31}             \n" // Also makes the hardware save the lazy S0-S15
+        "   STMDB   R0!, {R4-R11, LR}           \n" // Store R4-R11 and EXC_RETURN onto task's stack
+#else
         "   STMDB   R0!, {R4-R11}               \n" // Store R4-R11 onto task's stack
+#endif
         "   STR     R0, [R2]                    \n" // Save updated PSP into CurrentTask->CurrentPSP
+#if OS_STACK_CHECK == 1
+        // Check the stack of the current task
+        "   LDR     R1, [R2, #4]                \n" // Load CurrentTask->_E_PSP_Task (canary address)
+        "   CMP     R0, R1                      \n" // Context saved on or below the canary?
+        "   BLS     1f                          \n"
+        "   LDR     R1, [R1]                    \n" // Load the canary word
+        "   LDR     R12, =" OS_XSTR(OS_STACK_CANARY_VALUE) " \n"
+        "   CMP     R1, R12                     \n" // Canary overwritten?
+        "   BNE     1f                          \n"
+#endif
 
         // Switch to the next task
         "   LDR     R2, [R3, #4]                \n" // Load address of NextTask (Offset 24 in OS_StructOS)
         "   LDR     R0, [R2]                    \n" // Load PSP of the next task
         "   STR     R2, [R3, #0]                \n" // OS_StructOS.CurrentTask = OS_StructOS.NextTask
+#if OS_MPU_ENABLE == 1
+        // Program the MPU regions of the next task, R4-R9 are restored just after
+        "   ADD     R1, R2, #12                 \n" // Address of NextTask->MpuRegions
+        "   LDMIA   R1, {R4-R9}                 \n" // Three RBAR / RASR pairs
+        "   LDR     R1, =0xE000ED9C             \n" // MPU->RBAR, followed by RASR and the alias pairs
+        "   STMIA   R1, {R4-R9}                 \n"
+        "   DSB                                 \n"
+        "   ISB                                 \n"
+#endif
         "   MOV     R2, #0                      \n" // Clear NextTask
         "   STR     R2, [R3, #4]                \n" // OS_StructOS.NextTask = NULL
 
         // Restore context of the next task
+#if OS_PORT == OS_PORT_CORTEX_M4F
+        "   LDMIA   R0!, {R4-R11, LR}           \n" // Restore R4-R11 and EXC_RETURN of the next task
+        "   TST     LR, #0x10                   \n" // Did it use the FPU?
+        "   IT      EQ                          \n"
+        "   VLDMIAEQ R0!, {S16-S31}             \n"
+#else
         "   LDMIA   R0!, {R4-R11}               \n" // Restore R4-R11 from task's stack
+#endif
         "   MSR     PSP, R0                     \n" // Update PSP for the next task
 
         // Clear contextSwitch (indicating context switch is complete)
@@ -235,8 +294,80 @@ __attribute__((naked)) void PendSV_Handler(void) {
         "   STRB    R2, [R3]                    \n" // contextSwitch = 0
 
         "   BX      LR                          \n" // Return to Thread Mode
+#if OS_STACK_CHECK == 1
+        // Stack overflow of the current task
+        "1: MOV     R0, R2                      \n" // Argument: CurrentTask
+        "   B       OS_voidStackOverflowHook    \n"
+#endif
     );
 }
+#if OS_MPU_ENABLE == 1
+/* RASR of a region of 2^Copy_u32SizeLog2 bytes */
+#define OS_MPU_RASR(Copy_u32SizeLog2, Copy_u32Attributes) \
+	((((Copy_u32SizeLog2) - 1) << MPU_RASR_SIZE_Pos) | (Copy_u32Attributes) | MPU_RASR_ENABLE_Msk)
+/* Memory types: normal memory (write through) and device memory */
+#define OS_MPU_NORMAL   (MPU_RASR_S_Msk | MPU_RASR_C_Msk)
+#define OS_MPU_DEVICE   (MPU_RASR_S_Msk | MPU_RASR_B_Msk)
+
+/** OS_voidMpuInit
+ * @brief Programs the regions shared by all tasks and the regions of the first task, then enables
+ *        the MPU and the MemManage fault.
+ *
+ * @details
+ * Regions 0 to 2 (code, SRAM, peripherals) never change. Privileged code keeps the default
+ * memory map (PRIVDEFENA), so the kernel runs as without MPU. Regions 5 to 7 belong to the
+ * running task and are written by PendSV_Handler, region 7 (highest priority) is the stack guard.
+ */
+void OS_voidMpuInit(){
+	MPU->CTRL = 0;
+	MPU->RBAR = OS_MPU_FLASH_BASE | MPU_RBAR_VALID_Msk | (0 << MPU_RBAR_REGION_Pos);
+	MPU->RASR = OS_MPU_RASR(OS_MPU_FLASH_SIZE_LOG2, OS_MPU_READ_ONLY | MPU_RASR_C_Msk);
+	MPU->RBAR = OS_MPU_SRAM_BASE | MPU_RBAR_VALID_Msk | (1 << MPU_RBAR_REGION_Pos);
+	MPU->RASR = OS_MPU_RASR(OS_MPU_SRAM_SIZE_LOG2, OS_MPU_READ_WRITE | OS_MPU_NORMAL | OS_MPU_EXECUTE_NEVER);
+	MPU->RBAR = OS_MPU_PERIPH_BASE | MPU_RBAR_VALID_Msk | (2 << MPU_RBAR_REGION_Pos);
+	MPU->RASR = OS_MPU_RASR(OS_MPU_PERIPH_SIZE_LOG2, OS_MPU_READ_WRITE | OS_MPU_DEVICE | OS_MPU_EXECUTE_NEVER);
+	for(u32 i = 0 ; i < OS_MPU_TASK_REGIONS ; i++){
+		MPU->RBAR = OS_StructOS.CurrentTask->MpuRegions[2 * i];
+		MPU->RASR = OS_StructOS.CurrentTask->MpuRegions[2 * i + 1];
+	}
+	MPU->CTRL = MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_ENABLE_Msk;
+	SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+	__DSB();
+	__ISB();
+}
+/** OS_voidMpuTaskInit
+ * @brief Sets the stack guard region of a task and disables its two data regions.
+ */
+void OS_voidMpuTaskInit(OS_structTask* Add_structTask){
+	// Stack guard: the lowest OS_STACK_GUARD_SIZE bytes, no access for the task
+	Add_structTask->MpuRegions[0] = Add_structTask->_E_PSP_Task | MPU_RBAR_VALID_Msk | (7 << MPU_RBAR_REGION_Pos);
+	Add_structTask->MpuRegions[1] = OS_MPU_RASR(5, OS_MPU_NO_ACCESS | OS_MPU_NORMAL | OS_MPU_EXECUTE_NEVER);
+	for(u32 i = 1 ; i < OS_MPU_TASK_REGIONS ; i++){
+		Add_structTask->MpuRegions[2 * i] = MPU_RBAR_VALID_Msk | ((4 + i) << MPU_RBAR_REGION_Pos);
+		Add_structTask->MpuRegions[2 * i + 1] = 0;
+	}
+}
+/** OS_enumMpuSetTaskRegion
+ * @brief Sets a data region of a task, see Porting_CortexM.h.
+ */
+OS_enumErrorStatus OS_enumMpuSetTaskRegion(OS_structTask* Add_structTask, u8 Copy_u8Region, u32 Copy_u32Base, u8 Copy_u8SizeLog2, u32 Copy_u32Access){
+	if((Copy_u8Region >= (OS_MPU_TASK_REGIONS - 1)) || (Copy_u8SizeLog2 < 5) || (Copy_u32Base & ((1UL << Copy_u8SizeLog2) - 1)))
+		return TASK_CREATION_ERROR;
+
+	Add_structTask->MpuRegions[2 * (Copy_u8Region + 1)] = Copy_u32Base | MPU_RBAR_VALID_Msk | ((5 + Copy_u8Region) << MPU_RBAR_REGION_Pos);
+	Add_structTask->MpuRegions[2 * (Copy_u8Region + 1) + 1] = Copy_u32Access ? OS_MPU_RASR(Copy_u8SizeLog2, Copy_u32Access | OS_MPU_NORMAL) : 0;
+	return OS_OK;
+}
+#endif
+/** OS_voidStackOverflowHook
+ * @brief Called by PendSV_Handler when the task it switches out overflowed its stack.
+ *
+ * The default hook stops here, the application may define its own one (it must not return).
+ */
+__attribute__((weak)) void OS_voidStackOverflowHook(OS_structTask* Add_structTask){
+	(void)Add_structTask;
+	while(1);
+}
 //__attribute((naked)) void PendSV_Handler(void)
 //{
 //	/* Context Switching */
@@ -297,3 +428,4 @@ __attribute__((naked)) void PendSV_Handler(void) {
 //	__asm volatile("BX LR");
 //}
 
+#endif /* OS_PORT == OS_PORT_CORTEX_M3 || OS_PORT == OS_PORT_CORTEX_M4F */
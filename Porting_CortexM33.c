@@ -0,0 +1,173 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Handling Ports according to ARM CortexM33 (ARMv8-M)*/
+/****************************************************************/
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "MyRTOSConfig.h"
+#include "Mem_Management.h"
+
+#if OS_PORT == OS_PORT_CORTEX_M33
+
+/* Differences with the Cortex-M3 port (Porting_CortexM.c):
+ * - Stack overflows are detected by the hardware: PSPLIM is set to the bottom of the stack of
+ *   the running task, any push below it raises a UsageFault (STKOF) instead of corrupting the
+ *   next stack. PendSV_Handler stores R4-R11 through R0, which PSPLIM does not check, so it
+ *   compares that frame with PSPLIM itself. It has no canary check and no MPU regions to reprogram.
+ * - EXC_RETURN: bits 6 (S), 5 (DCRS), 4 (FType) and 0 (ES) are new on ARMv8-M. PendSV_Handler
+ *   and SVC_Handler return with the LR given by the hardware and only test bit 2 (SPSEL), so the
+ *   same code runs in the Secure state, the Non-secure state and on devices without TrustZone.
+ *   Tasks must not use the FPU (FType = 0 frames are not handled). */
+
+/* Variable for ticker checking */
+uint8_t Global_u8SystickLed;
+
+/* FAULTS : useful for debugging */
+void NMI_Handler(void)
+{
+	while (1);
+}
+void HardFault_Handler(void)
+{
+	while (1);
+}
+void MemManage_Handler(void)
+{
+	while (1);
+}
+void BusFault_Handler(void)
+{
+	while (1);
+}
+/**
+  * @brief This function handles Undefined instruction, illegal state and stack limit violations.
+  */
+void UsageFault_Handler(void)
+{
+	/* PSPLIM violation: the running task overflowed its stack */
+	if(SCB->CFSR & SCB_CFSR_STKOF_Msk)
+		OS_voidStackOverflowHook(OS_StructOS.CurrentTask);
+	while (1);
+}
+void SysTick_Handler(void)
+{
+	u32 Loc_u32State;
+	/* For Testing */
+	Global_u8SystickLed ^= 1;
+	/* ISRs may wake tasks too */
+	OS_ENTER_CRITICAL(Loc_u32State);
+	/* Update Number of Ticks */
+	OS_enumUpdateNoOfTicks();
+	/* Decide Current and Next task and trigger PendSV, deferred while the scheduler is locked */
+	OS_voidSchedule();
+	OS_EXIT_CRITICAL(Loc_u32State);
+}
+
+/* SVC Handler, same as the Cortex-M3 port: EXC_RETURN bit 2 tells which stack holds the frame */
+__attribute ((naked)) void SVC_Handler(){
+	__asm("TST LR , #4 \n\t"
+		  "ITE EQ \n\t" // If then equal
+		  "MRSEQ R0 , MSP \n\t"
+		  "MRSNE R0 , PSP \n\t"
+		  "B OS_voidSvcServices"
+	);
+}
+
+/* Externed from startup code */
+extern u32 _estack ;
+
+void OS_voidHwInit(){
+	/* Decrease PendSV priority to be equal to Systick Priority */
+	__NVIC_SetPriority(PendSV_IRQn,15);
+
+	/* Stack limit of the main stack, interrupts and the kernel run on it */
+	__set_MSPLIM((u32)&_estack - OS_MAIN_STACK_SIZE);
+
+	/* Report stack limit violations as UsageFault instead of HardFault */
+	SCB->SHCSR |= SCB_SHCSR_USGFAULTENA_Msk;
+}
+void OS_voidStartTimer(){
+	u32 Loc_u8Count = OS_TICK_TIME_IN_MS * OS_CPU_CLOCK_FREQ_IN_MHZ ;
+	SysTick_Config(Loc_u8Count);
+}
+
+/** PendSV_Handler
+ * @brief PendSV Handler for context switching between tasks (Cortex-M33).
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Saves the current task's context:
+ *    - Branches to `OS_voidStackOverflowHook` if the 32 bytes of R4 to R11 would go below PSPLIM.
+ *      The hardware only checks pushes through SP, not the store through R0 that follows.
+ *    - Manually pushes the registers R4 to R11 onto the stack.
+ *    - Saves the PSP in the task structure.
+ * 2. Switches to the next task:
+ *    - Sets the current task to the next task and clears the next task pointer.
+ * 3. Restores the next task's context:
+ *    - Sets PSPLIM to the bottom of the next task's stack (`_E_PSP_Task + OS_STACK_GUARD_SIZE`)
+ *      before the PSP, so the limit always matches the stack in use.
+ *    - Manually restores the registers R4 to R11 from the stack and sets the PSP.
+ * 4. Branches to the link register (LR), EXC_RETURN as given by the hardware.
+ */
+volatile uint8_t contextSwitch = 0;
+
+__attribute__((naked)) void PendSV_Handler(void) {
+    __asm volatile (
+        "   LDR     R3, =contextSwitch          \n"
+        "   MOVS    R2, #1                      \n"
+        "   STRB    R2, [R3]                    \n" // contextSwitch = 1
+
+        "   MRS     R0, PSP                     \n" // Load Process Stack Pointer (PSP)
+        "   LDR     R3, =OS_StructOS            \n" // Load address of OS_StructOS
+        "   LDR     R2, [R3, #0]                \n" // Load address of CurrentTask
+
+        // Save context of the current task, STMDB through R0 is not checked against PSPLIM
+        "   MRS     R1, PSPLIM                  \n" // Stack limit of the current task
+        "   SUB     R12, R0, #32                \n" // Lowest address of R4-R11
+        "   CMP     R12, R1                     \n" // Below the limit?
+        "   BLO     1f                          \n"
+        "   STMDB   R0!, {R4-R11}               \n" // Store R4-R11 onto task's stack
+        "   STR     R0, [R2]                    \n" // Save updated PSP into CurrentTask->CurrentPSP
+
+        // Switch to the next task
+        "   LDR     R2, [R3, #4]                \n" // Load address of NextTask
+        "   LDR     R0, [R2]                    \n" // Load PSP of the next task
+        "   STR     R2, [R3, #0]                \n" // OS_StructOS.CurrentTask = OS_StructOS.NextTask
+        "   LDR     R1, [R2, #4]                \n" // Load NextTask->_E_PSP_Task
+        "   ADD     R1, R1, #" OS_XSTR(OS_STACK_GUARD_SIZE) " \n"
+        "   MSR     PSPLIM, R1                  \n" // Stack limit of the next task
+        "   MOV     R2, #0                      \n" // Clear NextTask
+        "   STR     R2, [R3, #4]                \n" // OS_StructOS.NextTask = NULL
+
+        // Restore context of the next task
+        "   LDMIA   R0!, {R4-R11}               \n" // Restore R4-R11 from task's stack
+        "   MSR     PSP, R0                     \n" // Update PSP for the next task
+
+        "   LDR     R3, =contextSwitch          \n"
+        "   MOVS    R2, #0                      \n"
+        "   STRB    R2, [R3]                    \n" // contextSwitch = 0
+
+        "   BX      LR                          \n" // Return to Thread Mode
+
+        // Stack overflow of the current task
+        "1: MOV     R0, R2                      \n" // Argument: CurrentTask
+        "   B       OS_voidStackOverflowHook    \n"
+    );
+}
+/** OS_voidStackOverflowHook
+ * @brief Called by UsageFault_Handler when the running task pushed below its PSPLIM, or by
+ *        PendSV_Handler when its saved R4-R11 would go below it.
+ *
+ * The default hook stops here, the application may define its own one (it must not return).
+ */
+__attribute__((weak)) void OS_voidStackOverflowHook(OS_structTask* Add_structTask){
+	(void)Add_structTask;
+	while(1);
+}
+
+#endif /* OS_PORT == OS_PORT_CORTEX_M33 */
@@ -0,0 +1,148 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Message queues for inter-task communication        */
+/****************************************************************/
+#include <string.h>
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Queue.h"
+
+/** OS_enumCreateQueue
+ * @brief Initializes a message queue over a user provided buffer.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Checks the buffer is not NULL and the item size and length are not zero.
+ * 2. Resets the ring indices and the message counter.
+ * 3. Empties the sender and receiver wait lists.
+ */
+OS_tenuQueueState OS_enumCreateQueue(OS_tstructQueue* Add_structQueue, void* Add_voidBuffer, u32 Copy_u32ItemSize, u32 Copy_u32Length){
+	if(!Add_voidBuffer || !Copy_u32ItemSize || !Copy_u32Length)
+		return OS_QUEUE_INIT_ERROR;
+
+	Add_structQueue->Buffer   = (u8*)Add_voidBuffer;
+	Add_structQueue->ItemSize = Copy_u32ItemSize;
+	Add_structQueue->Length   = Copy_u32Length;
+	Add_structQueue->Count    = 0;
+	Add_structQueue->Head     = 0;
+	Add_structQueue->Tail     = 0;
+	Add_structQueue->SendWaitList    = NULL;
+	Add_structQueue->ReceiveWaitList = NULL;
+
+	return OS_QUEUE_INIT_OK;
+}
+
+/* Copies one message into the tail slot of the ring */
+static void OS_voidQueueWriteSlot(OS_tstructQueue* Add_structQueue, const void* Add_voidItem){
+	memcpy(&Add_structQueue->Buffer[Add_structQueue->Tail * Add_structQueue->ItemSize], Add_voidItem, Add_structQueue->ItemSize);
+	if(++Add_structQueue->Tail == Add_structQueue->Length)
+		Add_structQueue->Tail = 0;
+	Add_structQueue->Count++;
+}
+
+/* Copies the message of the head slot out of the ring */
+static void OS_voidQueueReadSlot(OS_tstructQueue* Add_structQueue, void* Add_voidItem){
+	memcpy(Add_voidItem, &Add_structQueue->Buffer[Add_structQueue->Head * Add_structQueue->ItemSize], Add_structQueue->ItemSize);
+	if(++Add_structQueue->Head == Add_structQueue->Length)
+		Add_structQueue->Head = 0;
+	Add_structQueue->Count--;
+}
+
+/** OS_voidQueueSendService
+ * @brief Kernel side of OS_enumQueueSend, runs in Handler Mode.
+ *
+ * @details
+ * 1. If a receiver is blocked, the message is copied directly into its buffer and it is woken.
+ * 2. Otherwise, if there is a free slot, the message is copied into the ring.
+ * 3. Otherwise the caller is blocked on the sender wait list (unless no wait was requested),
+ *    keeping a pointer to its message in `Waiting.Data` for the receiver to copy.
+ */
+void OS_voidQueueSendService(OS_tstructQueue* Add_structQueue, const void* Add_voidItem, u32 Copy_u32TicksToWait){
+	OS_structTask* Loc_structCurrentTask = OS_StructOS.CurrentTask;
+	OS_structTask* Loc_structReceiver = OS_structWaitListPop(&Add_structQueue->ReceiveWaitList);
+
+	Loc_structCurrentTask->Waiting.Result = OS_TASK_WAIT_OK;
+
+	if(Loc_structReceiver){
+		/* Queue is empty: skip the ring */
+		memcpy(Loc_structReceiver->Waiting.Data, Add_voidItem, Add_structQueue->ItemSize);
+		OS_voidWakeTask(Loc_structReceiver);
+		OS_voidSchedule();
+	}
+	else if(Add_structQueue->Count < Add_structQueue->Length){
+		OS_voidQueueWriteSlot(Add_structQueue, Add_voidItem);
+	}
+	else if(Copy_u32TicksToWait){
+		Loc_structCurrentTask->Waiting.Data = (void*)Add_voidItem;
+		OS_voidBlockCurrentTask(&Add_structQueue->SendWaitList, Copy_u32TicksToWait);
+	}
+	else{
+		Loc_structCurrentTask->Waiting.Result = OS_TASK_WAIT_TIMEOUT;
+	}
+}
+
+/** OS_voidQueueReceiveService
+ * @brief Kernel side of OS_enumQueueReceive, runs in Handler Mode.
+ *
+ * @details
+ * 1. If a message is stored, it is copied out of the ring. If a sender is blocked on the
+ *    now freed slot, its message is copied into the ring and it is woken.
+ * 2. Otherwise the caller is blocked on the receiver wait list (unless no wait was requested),
+ *    keeping a pointer to its buffer in `Waiting.Data` for the sender to fill.
+ */
+void OS_voidQueueReceiveService(OS_tstructQueue* Add_structQueue, void* Add_voidItem, u32 Copy_u32TicksToWait){
+	OS_structTask* Loc_structCurrentTask = OS_StructOS.CurrentTask;
+	OS_structTask* Loc_structSender;
+
+	Loc_structCurrentTask->Waiting.Result = OS_TASK_WAIT_OK;
+
+	if(Add_structQueue->Count){
+		OS_voidQueueReadSlot(Add_structQueue, Add_voidItem);
+		Loc_structSender = OS_structWaitListPop(&Add_structQueue->SendWaitList);
+		if(Loc_structSender){
+			OS_voidQueueWriteSlot(Add_structQueue, Loc_structSender->Waiting.Data);
+			OS_voidWakeTask(Loc_structSender);
+			OS_voidSchedule();
+		}
+	}
+	else if(Copy_u32TicksToWait){
+		Loc_structCurrentTask->Waiting.Data = Add_voidItem;
+		OS_voidBlockCurrentTask(&Add_structQueue->ReceiveWaitList, Copy_u32TicksToWait);
+	}
+	else{
+		Loc_structCurrentTask->Waiting.Result = OS_TASK_WAIT_TIMEOUT;
+	}
+}
+
+/** OS_enumQueueSend
+ * @brief Copies a message into the queue, blocking while it is full.
+ *
+ * The work is done by OS_voidQueueSendService through SVC_QUEUE_SEND, when the task
+ * runs again `Waiting.Result` tells whether the message was delivered.
+ */
+OS_tenuQueueState OS_enumQueueSend(OS_tstructQueue* Add_structQueue, const void* Add_voidItem, u32 Copy_u32TicksToWait){
+	OS_REQUEST_SERVICE_ARGS(SVC_QUEUE_SEND, Add_structQueue, Add_voidItem, Copy_u32TicksToWait);
+
+	if(OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK)
+		return OS_QUEUE_OK;
+	return Copy_u32TicksToWait ? OS_QUEUE_TIMEOUT : OS_QUEUE_FULL;
+}
+
+/** OS_enumQueueReceive
+ * @brief Copies the oldest message out of the queue, blocking while it is empty.
+ *
+ * The work is done by OS_voidQueueReceiveService through SVC_QUEUE_RECEIVE, when the task
+ * runs again `Waiting.Result` tells whether a message was received.
+ */
+OS_tenuQueueState OS_enumQueueReceive(OS_tstructQueue* Add_structQueue, void* Add_voidItem, u32 Copy_u32TicksToWait){
+	OS_REQUEST_SERVICE_ARGS(SVC_QUEUE_RECEIVE, Add_structQueue, Add_voidItem, Copy_u32TicksToWait);
+
+	if(OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK)
+		return OS_QUEUE_OK;
+	return Copy_u32TicksToWait ? OS_QUEUE_TIMEOUT : OS_QUEUE_EMPTY;
+}
@@ -0,0 +1,255 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Reader-writer locks for read-mostly shared data    */
+/****************************************************************/
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "MyRTOSConfig.h"
+#include "RWLock.h"
+
+/* Bits that keep new readers out of the fast path */
+#if OS_RWLOCK_WRITER_PREFERENCE == 1
+#define OS_RWLOCK_READ_BLOCKED      (OS_RWLOCK_WRITER | OS_RWLOCK_WRITERS_WAITING)
+#else
+#define OS_RWLOCK_READ_BLOCKED      (OS_RWLOCK_WRITER)
+#endif
+
+/** OS_enumInitRWLock
+ * @brief Initializes a reader-writer lock, free and without waiters.
+ */
+OS_tenuRWLockState OS_enumInitRWLock(OS_tstructRWLock* Add_structLock){
+	Add_structLock->State = 0;
+	Add_structLock->Writer = NULL;
+	Add_structLock->ReadWaitList = NULL;
+	Add_structLock->WriteWaitList = NULL;
+	return OS_RWLOCK_INIT_OK;
+}
+
+/* Adds a reader with an exclusive access, 0 if a writer holds or (writer preference) waits for the lock */
+static inline u8 OS_u8RWLockTryRead(OS_tstructRWLock* Add_structLock){
+	u32 Loc_u32Value;
+	do{
+		Loc_u32Value = __LDREXW(&Add_structLock->State);
+		if(Loc_u32Value & OS_RWLOCK_READ_BLOCKED){
+			__CLREX();
+			return 0;
+		}
+	}while(__STREXW(Loc_u32Value + 1, &Add_structLock->State));
+	__DMB();
+	return 1;
+}
+
+/* Removes a reader with an exclusive access, 0 if it is the last one and tasks wait (kernel needed) */
+static inline u8 OS_u8RWLockTryReadUnlock(OS_tstructRWLock* Add_structLock){
+	u32 Loc_u32Value;
+	__DMB();
+	do{
+		Loc_u32Value = __LDREXW(&Add_structLock->State);
+		if(((Loc_u32Value & OS_RWLOCK_READERS) == 1) &&
+		   (Loc_u32Value & (OS_RWLOCK_READERS_WAITING | OS_RWLOCK_WRITERS_WAITING))){
+			__CLREX();
+			return 0;
+		}
+	}while(__STREXW(Loc_u32Value - 1, &Add_structLock->State));
+	return 1;
+}
+
+/* Moves the lock word from one exact value to another with an exclusive access, 0 if it differs */
+static inline u8 OS_u8RWLockSwap(OS_tstructRWLock* Add_structLock, u32 Copy_u32From, u32 Copy_u32To){
+	do{
+		if(__LDREXW(&Add_structLock->State) != Copy_u32From){
+			__CLREX();
+			return 0;
+		}
+	}while(__STREXW(Copy_u32To, &Add_structLock->State));
+	return 1;
+}
+
+/** OS_enumRWLockRead
+ * @brief Takes the lock for reading, see the header for the steps.
+ */
+OS_tenuRWLockState OS_enumRWLockRead(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait){
+	OS_tenuRWLockState Loc_enumState = OS_RWLOCK_BUSY;
+
+	/* Fast path */
+	if(OS_u8RWLockTryRead(Add_structLock))
+		return OS_RWLOCK_ACQUIRED;
+	if(OS_IS_HANDLER_MODE() || !Copy_u32TicksToWait)
+		return OS_RWLOCK_BUSY;
+
+	/* Slow path */
+	OS_REQUEST_SERVICE_ARGS(SVC_RWLOCK_READ, Add_structLock, Copy_u32TicksToWait, &Loc_enumState);
+	if(Loc_enumState == OS_RWLOCK_BUSY)
+		Loc_enumState = (OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK) ? OS_RWLOCK_ACQUIRED : OS_RWLOCK_TIMEOUT;
+	return Loc_enumState;
+}
+
+/** OS_voidRWLockReadUnlock
+ * @brief Releases a read lock, through the kernel only if the last reader leaves while tasks wait.
+ */
+void OS_voidRWLockReadUnlock(OS_tstructRWLock* Add_structLock){
+	u32 Loc_u32State;
+
+	if(OS_u8RWLockTryReadUnlock(Add_structLock))
+		return;
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidRWLockUnlockService(Add_structLock, 0);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_RWLOCK_UNLOCK, Add_structLock, 0, 0);
+	}
+}
+
+/** OS_enumRWLockWrite
+ * @brief Takes a free lock for writing with LDREX / STREX, else blocks on the write wait list.
+ */
+OS_tenuRWLockState OS_enumRWLockWrite(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait){
+	OS_tenuRWLockState Loc_enumState = OS_RWLOCK_BUSY;
+	u8 Loc_u8Handler = OS_IS_HANDLER_MODE();
+
+	/* Fast path */
+	if(OS_u8RWLockSwap(Add_structLock, 0, OS_RWLOCK_WRITER)){
+		__DMB();
+		Add_structLock->Writer = Loc_u8Handler ? NULL : OS_StructOS.CurrentTask;
+		return OS_RWLOCK_ACQUIRED;
+	}
+	if(Loc_u8Handler || !Copy_u32TicksToWait)
+		return OS_RWLOCK_BUSY;
+
+	/* Slow path */
+	OS_REQUEST_SERVICE_ARGS(SVC_RWLOCK_WRITE, Add_structLock, Copy_u32TicksToWait, &Loc_enumState);
+	if(Loc_enumState == OS_RWLOCK_BUSY)
+		Loc_enumState = (OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK) ? OS_RWLOCK_ACQUIRED : OS_RWLOCK_TIMEOUT;
+	return Loc_enumState;
+}
+
+/** OS_voidRWLockWriteUnlock
+ * @brief Releases a write lock, through the kernel only if tasks wait.
+ */
+void OS_voidRWLockWriteUnlock(OS_tstructRWLock* Add_structLock){
+	u32 Loc_u32State;
+
+	Add_structLock->Writer = NULL;
+	__DMB();
+	if(OS_u8RWLockSwap(Add_structLock, OS_RWLOCK_WRITER, 0))
+		return;
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidRWLockUnlockService(Add_structLock, 1);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_RWLOCK_UNLOCK, Add_structLock, 1, 0);
+	}
+}
+
+/* Sets the waiting bits from the wait lists: waiters that timed out or were deleted leave them stale */
+static void OS_voidRWLockUpdateWaiters(OS_tstructRWLock* Add_structLock){
+	u32 Loc_u32Value = Add_structLock->State & ~(OS_RWLOCK_READERS_WAITING | OS_RWLOCK_WRITERS_WAITING);
+	if(Add_structLock->ReadWaitList)
+		Loc_u32Value |= OS_RWLOCK_READERS_WAITING;
+	if(Add_structLock->WriteWaitList)
+		Loc_u32Value |= OS_RWLOCK_WRITERS_WAITING;
+	Add_structLock->State = Loc_u32Value;
+}
+
+/** OS_voidRWLockHandOff
+ * @brief Gives a lock no writer holds to the waiters that may enter, with interrupts masked.
+ *
+ * @details
+ * 1. With writer preference, the highest priority waiting writer takes the lock once no reader is
+ *    left. The waiting readers enter only when no writer waits.
+ * 2. Without it, all the waiting readers enter at once, a writer takes the lock when no reader waits
+ *    or holds it.
+ * 3. Readers enter together: the count grows by the number of woken readers in one pass of the list.
+ * 4. Updates the waiting bits and reschedules once if tasks were woken.
+ */
+static void OS_voidRWLockHandOff(OS_tstructRWLock* Add_structLock){
+	OS_structTask* Loc_structTask;
+	u8 Loc_u8Woken = 0;
+
+	if(!(Add_structLock->State & OS_RWLOCK_WRITER)){
+#if OS_RWLOCK_WRITER_PREFERENCE == 1
+		if(Add_structLock->WriteWaitList){
+#else
+		if(Add_structLock->WriteWaitList && !Add_structLock->ReadWaitList){
+#endif
+			if(!(Add_structLock->State & OS_RWLOCK_READERS)){
+				Loc_structTask = OS_structWaitListPop(&Add_structLock->WriteWaitList);
+				Add_structLock->State |= OS_RWLOCK_WRITER;
+				Add_structLock->Writer = Loc_structTask;
+				OS_voidWakeTask(Loc_structTask);
+				Loc_u8Woken = 1;
+			}
+		}
+		else{
+			while((Loc_structTask = OS_structWaitListPop(&Add_structLock->ReadWaitList)) != NULL){
+				Add_structLock->State++;
+				OS_voidWakeTask(Loc_structTask);
+				Loc_u8Woken = 1;
+			}
+		}
+	}
+	OS_voidRWLockUpdateWaiters(Add_structLock);
+	if(Loc_u8Woken)
+		OS_voidSchedule();
+}
+
+/** OS_enumRWLockReadService
+ * @brief Slow path of OS_enumRWLockRead, runs in Handler Mode with interrupts masked.
+ *
+ * Enters if the lock allows it now (a writer left, or the waiting bit that sent the task here was
+ * stale), else sets OS_RWLOCK_READERS_WAITING and blocks the task on the read wait list.
+ */
+OS_tenuRWLockState OS_enumRWLockReadService(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait){
+	OS_voidRWLockUpdateWaiters(Add_structLock);
+	if(!(Add_structLock->State & OS_RWLOCK_READ_BLOCKED)){
+		Add_structLock->State++;
+		return OS_RWLOCK_ACQUIRED;
+	}
+	Add_structLock->State |= OS_RWLOCK_READERS_WAITING;
+	OS_voidBlockCurrentTask(&Add_structLock->ReadWaitList, Copy_u32TicksToWait);
+	return OS_RWLOCK_BUSY;
+}
+
+/** OS_enumRWLockWriteService
+ * @brief Slow path of OS_enumRWLockWrite, runs in Handler Mode with interrupts masked.
+ *
+ * Takes the lock if no reader or writer holds it, else sets OS_RWLOCK_WRITERS_WAITING and blocks
+ * the task on the write wait list.
+ */
+OS_tenuRWLockState OS_enumRWLockWriteService(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait){
+	if(!(Add_structLock->State & (OS_RWLOCK_WRITER | OS_RWLOCK_READERS))){
+		Add_structLock->State |= OS_RWLOCK_WRITER;
+		Add_structLock->Writer = OS_StructOS.CurrentTask;
+		OS_voidRWLockUpdateWaiters(Add_structLock);
+		return OS_RWLOCK_ACQUIRED;
+	}
+	Add_structLock->State |= OS_RWLOCK_WRITERS_WAITING;
+	OS_voidBlockCurrentTask(&Add_structLock->WriteWaitList, Copy_u32TicksToWait);
+	return OS_RWLOCK_BUSY;
+}
+
+/** OS_voidRWLockUnlockService
+ * @brief Slow path of the unlocks, runs in Handler Mode with interrupts masked.
+ *
+ * Removes the writer or one reader, then hands the lock to the waiters (OS_voidRWLockHandOff).
+ */
+void OS_voidRWLockUnlockService(OS_tstructRWLock* Add_structLock, u8 Copy_u8Writer){
+	if(Copy_u8Writer){
+		Add_structLock->State &= ~OS_RWLOCK_WRITER;
+		Add_structLock->Writer = NULL;
+	}
+	else if(Add_structLock->State & OS_RWLOCK_READERS){
+		Add_structLock->State--;
+	}
+	OS_voidRWLockHandOff(Add_structLock);
+}
@@ -12,93 +12,63 @@
 #include "Porting_CortexM.h"
 #include "Task.h"
 #include "Scheduler.h"
+#include "Queue.h"
+#include "StreamBuffer.h"
+#include "PingPong.h"
+#include "MemPool.h"
+#include "Mem_Management.h"
+#include "Coroutine.h"
+#include "Semaphore.h"
+#include "EventGroup.h"
+#include "RWLock.h"
+#include "CondVar.h"
+#include "Barrier.h"
 
 #include "MyRTOSConfig.h"
-/* Ready Queue for the OS scheduler */
-OS_tBuffer Global_structReadyQueue[OS_TASK_PRIORITY_LEVELS]; // 8 * 32 = 256
-OS_structTask* Global_structReadyQueueFIFO[OS_TASK_PRIORITY_LEVELS][5];
+/* Ready Queue for the OS scheduler, one per priority */
+OS_tstructReadyQueue Global_structReadyQueue[OS_TASK_PRIORITY_LEVELS];
 /* Idle Task Structure */
 OS_structTask Global_structIdleTask;
 
 extern u8 Global_u8Scheduler;
 
-/** OS_voidSortSchedulerTable
- * @brief Sorts the scheduler table based on task priorities.
- *
- * This function sorts the tasks in the scheduler table in ascending order of their priorities
- * using the Bubble Sort algorithm. Tasks with lower priority values will be placed before tasks
- * with higher priority values.
- *
- * @details
- * The function performs the following steps:
- * 1. Iterates over the task table multiple times, comparing each task's priority with the next task's priority.
- * 2. Swaps tasks if the current task's priority is greater than the next task's priority.
- * 3. Repeats the process until the entire table is sorted.
- *
- * Example usage:
- * @code
- * OS_voidSortSchedulerTable();
- * // The scheduler table is now sorted based on task priorities.
- * @endcode
- */
-void OS_voidSortSchedulerTable(){
-
-	for(u8 i = 0 ; i < OS_StructOS.NoOfCreatedTasks-1 ; i++)
-		for(u8 j = 0 ; j < OS_StructOS.NoOfCreatedTasks - i - 1 ; j++)
-			if(OS_StructOS.TaskTable[j]->Priority > OS_StructOS.TaskTable[j+1]->Priority){
-				OS_structTask * temp ;
-				temp = OS_StructOS.TaskTable[j] ;
-				OS_StructOS.TaskTable[j] =  OS_StructOS.TaskTable[j+1];
-				OS_StructOS.TaskTable[j+1] = temp ;
-			}
-
-}
 /** OS_voidUpdateReadyQueue
  * @brief Updates the ready queue for task scheduling.
  *
- * This function updates the ready queue by removing all tasks from the queue and re-adding tasks
- * that are ready to be scheduled. It ensures that tasks with the highest priority are at the front
- * of the queue and only non-suspended tasks are considered.
+ * This function updates the ready queues by removing all tasks from them and re-adding tasks
+ * that are ready to be scheduled, each one to the queue of its priority.
  *
  * @details
  * The function performs the following steps:
- * 1. Frees the ready queue by dequeuing all tasks until the queue is empty.
- * 2. Iterates over the task table to identify tasks that are not suspended.
- * 3. Enqueues tasks that are ready to be scheduled based on their priority.
- *    - Tasks with a lower priority value are enqueued first.
- *    - If two tasks have the same priority, they are both enqueued.
- * 4. Updates the task state to `OS_TASK_READY` for enqueued tasks.
+ * 1. Frees every ready queue and clears the ready bitmaps.
+ * 2. Iterates over the list of created tasks to identify tasks that are neither suspended, waiting nor running.
+ * 3. Enqueues these tasks using `OS_MarkTaskReady`, one ready queue per priority.
  *
  * Example usage:
  * @code
  * OS_voidUpdateReadyQueue();
- * // The ready queue is now updated with tasks ready to be scheduled.
+ * // The ready queues are now updated with tasks ready to be scheduled.
  * @endcode
  */
 void OS_voidUpdateReadyQueue(){
 
-	OS_structTask* temp = NULL ;
 	OS_structTask* loc_structCurrentTask = NULL ;
-	OS_structTask* loc_structNextTask = NULL ;
-    // 1- Free ready queue
-    while(OS_enumFifoDequeue(&Global_structReadyQueue, &temp) != FIFO_EMPTY);
-
-    // 2- Update ready queue
-    for(u8 i = 0; i < OS_StructOS.NoOfCreatedTasks; i++){
-    	loc_structCurrentTask = OS_StructOS.TaskTable[i];
-    	loc_structNextTask = OS_StructOS.TaskTable[i+1];
-        // Check if the task is not suspended
-        if(loc_structCurrentTask->TaskState != OS_TASK_SUSPEND){
-
-        	if((loc_structNextTask->TaskState == OS_TASK_SUSPEND) || (loc_structCurrentTask->Priority<loc_structNextTask->Priority)){
-        		OS_enumFifoEnqueue(&Global_structReadyQueue, loc_structCurrentTask);
-        		loc_structCurrentTask->TaskState = OS_TASK_READY ;
-        		break;
-        	}
-        	if(loc_structCurrentTask->Priority == loc_structNextTask->Priority){
-        		OS_enumFifoEnqueue(&Global_structReadyQueue, loc_structCurrentTask);
-        		loc_structCurrentTask->TaskState = OS_TASK_READY ;
-        	}
+    // 1- Free ready queues
+    for(u8 i = 0; i < OS_TASK_PRIORITY_LEVELS; i++){
+    	Global_structReadyQueue[i].Head = NULL;
+    	Global_structReadyQueue[i].Tail = NULL;
+    }
+    for(u8 i = 0; i < OS_TASKS_NO_OF_CLUSTERS; i++){
+    	OS_StructOS.bitMap1[i] = 0;
+    }
+    OS_StructOS.bitMap0 = 0;
+
+    // 2- Update ready queues
+    for(loc_structCurrentTask = OS_StructOS.TaskList; loc_structCurrentTask; loc_structCurrentTask = loc_structCurrentTask->AllTasks.Next){
+        loc_structCurrentTask->Ready.Next = NULL;
+        loc_structCurrentTask->Ready.Prev = NULL;
+        if(loc_structCurrentTask->TaskState == OS_TASK_READY){
+        	OS_MarkTaskReady(loc_structCurrentTask);
         }
     }
 }
@@ -119,14 +89,52 @@ void OS_MarkTaskReady(OS_structTask* task) {
     uint8_t offset = prio % OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER;
 
     uint8_t queueIndex = group * OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER + offset;
+    OS_tstructReadyQueue* queue = &Global_structReadyQueue[queueIndex];
     task->TaskState = OS_TASK_READY;
 
-    OS_enumFifoEnqueue(&Global_structReadyQueue[queueIndex], task);
+    // Link at the tail, the queue has room for every task
+    task->Ready.Next = NULL;
+    task->Ready.Prev = queue->Tail;
+    if (queue->Tail)
+        queue->Tail->Ready.Next = task;
+    else
+        queue->Head = task;
+    queue->Tail = task;
 
     OS_StructOS.bitMap1[group] |= (1 << offset);
     OS_StructOS.bitMap0 |= (1U << group);
 }
 
+/** OS_voidReadyQueueRemove
+ * @brief Removes a task from the ready queue of its priority in O(1) (no effect if it is not there).
+ *
+ * The other tasks of the queue keep their order, the bitmap bit is cleared once the queue is empty.
+ */
+void OS_voidReadyQueueRemove(OS_structTask* Add_structTask){
+	u8 Loc_u8Group = Add_structTask->Priority / OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER;
+	u8 Loc_u8Offset = Add_structTask->Priority % OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER;
+	OS_tstructReadyQueue* Loc_structQueue = &Global_structReadyQueue[Add_structTask->Priority];
+
+	// A queued task either has a previous task or is the head
+	if(!Add_structTask->Ready.Prev && (Loc_structQueue->Head != Add_structTask))
+		return;
+	if(Add_structTask->Ready.Prev)
+		Add_structTask->Ready.Prev->Ready.Next = Add_structTask->Ready.Next;
+	else
+		Loc_structQueue->Head = Add_structTask->Ready.Next;
+	if(Add_structTask->Ready.Next)
+		Add_structTask->Ready.Next->Ready.Prev = Add_structTask->Ready.Prev;
+	else
+		Loc_structQueue->Tail = Add_structTask->Ready.Prev;
+	Add_structTask->Ready.Next = NULL;
+	Add_structTask->Ready.Prev = NULL;
+	if(!Loc_structQueue->Head){
+		OS_StructOS.bitMap1[Loc_u8Group] &= ~(1 << Loc_u8Offset);
+		if(OS_StructOS.bitMap1[Loc_u8Group] == 0)
+			OS_StructOS.bitMap0 &= ~(1U << Loc_u8Group);
+	}
+}
+
 void OS_MarkTaskNotReady(OS_structTask* task) {
     u8 prio = task->Priority;
     uint8_t group = prio / OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER;
@@ -153,17 +161,16 @@ void OS_MarkTaskNotReady(OS_structTask* task) {
  *
  * @details
  * The function performs the following steps:
- * 1. Checks if the ready queue is empty and the current task is not suspended.
- *    - If both conditions are met, it continues running the current task:
- *      - Marks the current task as running.
- *      - Enqueues the current task back into the ready queue.
- *      - Sets the next task to the current task.
- * 2. If the ready queue is not empty or the current task is suspended:
- *    - Dequeues the next task from the ready queue.
+ * 1. Returns a task chosen by a previous decision, not yet switched to by PendSV, to its ready queue.
+ * 2. If no task is ready, keeps the current task while it is still running (idle task otherwise).
+ * 3. Keeps the current task if it is still running and has a higher priority than every ready task,
+ *    or if its preemption threshold (`PreemptionThreshold`, when above its priority) is not below
+ *    the highest ready priority: tasks up to the threshold, its own priority included (no round
+ *    robin), wait until it blocks, delays or ends.
+ * 4. Otherwise:
+ *    - Dequeues the next task from the highest priority ready queue and clears its bitmap bit once empty.
+ *    - Enqueues the current task back into its ready queue if it was preempted or shares the priority.
  *    - Marks the next task as running.
- *    - Checks if the next task has the same priority as the current task and the current task is not suspended:
- *      - Enqueues the current task back into the ready queue.
- *      - Marks the current task as ready.
  *
  * Example usage:
  * @code
@@ -172,10 +179,18 @@ void OS_MarkTaskNotReady(OS_structTask* task) {
  * @endcode
  */
 void OS_voidDecideNext() {
-    // No ready task and current still active
-    if ((OS_StructOS.bitMap0 == 0) && (OS_StructOS.CurrentTask->TaskState != OS_TASK_SUSPEND)) {
-        OS_StructOS.CurrentTask->TaskState = OS_TASK_RUNNING;
-        OS_StructOS.NextTask = OS_StructOS.CurrentTask;
+    OS_structTask* current = OS_StructOS.CurrentTask;
+    OS_structTask* next = NULL;
+
+    // A decision not applied yet by PendSV is taken again from scratch
+    if (OS_StructOS.NextTask && (OS_StructOS.NextTask != current) &&
+        (OS_StructOS.NextTask->TaskState == OS_TASK_RUNNING)) {
+        OS_MarkTaskReady(OS_StructOS.NextTask);
+    }
+
+    // No ready task: keep current if still active
+    if (OS_StructOS.bitMap0 == 0) {
+        OS_StructOS.NextTask = (current->TaskState == OS_TASK_RUNNING) ? current : &Global_structIdleTask;
         return;
     }
 
@@ -184,22 +199,248 @@ void OS_voidDecideNext() {
     uint8_t prioInGroup = FindHighestSetBit8(OS_StructOS.bitMap1[group]);
     uint8_t queueIndex = group * OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER + prioInGroup;
 
-    OS_structTask* next;
-    OS_enumFifoDequeue(&Global_structReadyQueue[queueIndex], &next);
+    // Current keeps the CPU unless a task above its threshold, or of its priority (round robin
+    // when no threshold is set), is ready
+    if ((current->TaskState == OS_TASK_RUNNING) &&
+        ((current->Priority > queueIndex) ||
+         ((current->PreemptionThreshold > current->Priority) && (current->PreemptionThreshold >= queueIndex)))) {
+        OS_StructOS.NextTask = current;
+        return;
+    }
+
+    // Dequeue the head of the highest priority ready queue
+    OS_tstructReadyQueue* queue = &Global_structReadyQueue[queueIndex];
+    next = queue->Head;
+    if (next) {
+        queue->Head = next->Ready.Next;
+        if (queue->Head)
+            queue->Head->Ready.Prev = NULL;
+        next->Ready.Next = NULL;
+    }
+    if (!queue->Head) {
+        queue->Tail = NULL;
+        OS_StructOS.bitMap1[group] &= ~(1 << prioInGroup);
+        if (OS_StructOS.bitMap1[group] == 0)
+            OS_StructOS.bitMap0 &= ~(1U << group);
+    }
     if (next == NULL) {
         OS_StructOS.NextTask = &Global_structIdleTask;
         return;
     }
 
+    // Preempted or round robin: current goes back to its ready queue
+    if ((current->TaskState == OS_TASK_RUNNING) && (current != next)) {
+        OS_MarkTaskReady(current);
+    }
+
     // Assign next task
     next->TaskState = OS_TASK_RUNNING;
     OS_StructOS.NextTask = next;
+}
 
-    // Optional: round robin enqueue of current if same priority
-    if ((OS_StructOS.CurrentTask->TaskState != OS_TASK_SUSPEND) &&
-        (OS_StructOS.CurrentTask->Priority == next->Priority)) {
-        OS_MarkTaskReady(OS_StructOS.CurrentTask);
-    }
+/** OS_u8ScheduleDeferred
+ * @brief Tells whether a scheduling decision must wait for OS_voidSchedulerUnlock, and records it.
+ *
+ * Decisions are deferred while the scheduler is locked and the task holding the lock still runs.
+ * A task that blocks or ends anyway is switched out, the lock must not be held across a wait.
+ */
+u8 OS_u8ScheduleDeferred(){
+	if(OS_StructOS.SchedulerLock && (OS_StructOS.CurrentTask->TaskState == OS_TASK_RUNNING)){
+		OS_StructOS.ScheduleDeferred = 1;
+		return 1;
+	}
+	OS_StructOS.ScheduleDeferred = 0;
+	return 0;
+}
+
+/** OS_voidSchedule
+ * @brief Takes a scheduling decision and requests a context switch if needed.
+ *
+ * Must be called from Handler Mode (SVC or SysTick) after the ready queues were changed.
+ * While the scheduler is locked the decision is deferred to the last OS_voidSchedulerUnlock.
+ */
+void OS_voidSchedule(){
+	if(OS_StructOS.OS_enumMode != OS_RUNNING)
+		return;
+	if(OS_u8ScheduleDeferred())
+		return;
+	Global_u8Scheduler ^=1;
+	OS_voidDecideNext();
+	Global_u8Scheduler ^=1;
+	if(OS_StructOS.NextTask && OS_StructOS.NextTask != OS_StructOS.CurrentTask)
+		OS_TRIGGER_PENDSV();
+}
+
+/** OS_voidSchedulerLock
+ * @brief Holds off preemption of the running task until the matching OS_voidSchedulerUnlock.
+ *
+ * The nesting count is changed by the running task, and by interrupt handlers only through
+ * balanced lock / unlock pairs: a handler gives the count back as it found it before the task
+ * resumes, so a plain increment is enough even if it preempts one. No SVC and no interrupt masking.
+ */
+void OS_voidSchedulerLock(){
+	OS_StructOS.SchedulerLock++;
+	__DMB();
+}
+
+/** OS_voidSchedulerUnlock
+ * @brief Ends a scheduler lock, the last unlock takes the deferred decision if there is one.
+ *
+ * @details
+ * 1. Decrements the nesting count.
+ * 2. If it reached 0 and a decision was deferred meanwhile, takes it: through SVC_SCHEDULER_UNLOCK
+ *    from a task, directly with interrupts masked from an interrupt handler. An unlock with nothing
+ *    deferred costs no kernel entry.
+ */
+void OS_voidSchedulerUnlock(){
+	u32 Loc_u32State;
+
+	__DMB();
+	if(!OS_StructOS.SchedulerLock)
+		return;
+	if(--OS_StructOS.SchedulerLock || !OS_StructOS.ScheduleDeferred)
+		return;
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidSchedule();
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE(SVC_SCHEDULER_UNLOCK);
+	}
+}
+
+/** OS_voidWaitListInsert
+ * @brief Inserts a task in a kernel object wait list ordered by priority.
+ *
+ * Higher priority tasks are placed first, tasks of the same priority keep their arrival order.
+ * Each task keeps the address of the link pointing to it (`Waiting.WaitLink`) so it can leave
+ * the list in O(1).
+ */
+void OS_voidWaitListInsert(OS_structTask** Add_structWaitList, OS_structTask* Add_structTask){
+	OS_structTask** Loc_structLink = Add_structWaitList;
+	while(*Loc_structLink && ((*Loc_structLink)->Priority >= Add_structTask->Priority))
+		Loc_structLink = &((*Loc_structLink)->Waiting.NextWaiter);
+	Add_structTask->Waiting.NextWaiter = *Loc_structLink;
+	if(*Loc_structLink)
+		(*Loc_structLink)->Waiting.WaitLink = &Add_structTask->Waiting.NextWaiter;
+	*Loc_structLink = Add_structTask;
+	Add_structTask->Waiting.WaitLink = Loc_structLink;
+	Add_structTask->Waiting.WaitHead = Add_structWaitList;
+}
+
+/** OS_structWaitListPop
+ * @brief Removes and returns the highest priority task of a wait list (NULL if empty).
+ */
+OS_structTask* OS_structWaitListPop(OS_structTask** Add_structWaitList){
+	OS_structTask* Loc_structTask = *Add_structWaitList;
+	if(Loc_structTask)
+		OS_voidWaitListRemove(Loc_structTask);
+	return Loc_structTask;
+}
+
+/** OS_voidWaitListRemove
+ * @brief Unlinks a task from the wait list it is blocked on in O(1) (used when its wait times out).
+ */
+void OS_voidWaitListRemove(OS_structTask* Add_structTask){
+	OS_structTask** Loc_structLink = Add_structTask->Waiting.WaitLink;
+	if(!Loc_structLink)
+		return;
+	*Loc_structLink = Add_structTask->Waiting.NextWaiter;
+	if(Add_structTask->Waiting.NextWaiter)
+		Add_structTask->Waiting.NextWaiter->Waiting.WaitLink = Loc_structLink;
+	Add_structTask->Waiting.NextWaiter = NULL;
+	Add_structTask->Waiting.WaitLink = NULL;
+	Add_structTask->Waiting.WaitHead = NULL;
+}
+
+/** OS_voidTimeoutInsert
+ * @brief Inserts a task in the timeout list, sorted by wake tick.
+ *
+ * Tasks with the same wake tick keep their arrival order. Ticks are compared as signed
+ * differences so OS_StructOS.TickCount may wrap around (timeouts below 2^31 ticks).
+ */
+void OS_voidTimeoutInsert(OS_structTask* Add_structTask, u32 Copy_u32Ticks){
+	OS_structTask* Loc_structPrev = NULL;
+	OS_structTask* Loc_structNext = OS_StructOS.TimeoutList;
+
+	Add_structTask->Waiting.WakeTick = OS_StructOS.TickCount + Copy_u32Ticks;
+	while(Loc_structNext && ((s32)(Loc_structNext->Waiting.WakeTick - Add_structTask->Waiting.WakeTick) <= 0)){
+		Loc_structPrev = Loc_structNext;
+		Loc_structNext = Loc_structNext->Waiting.NextTimeout;
+	}
+	Add_structTask->Waiting.PrevTimeout = Loc_structPrev;
+	Add_structTask->Waiting.NextTimeout = Loc_structNext;
+	if(Loc_structPrev)
+		Loc_structPrev->Waiting.NextTimeout = Add_structTask;
+	else
+		OS_StructOS.TimeoutList = Add_structTask;
+	if(Loc_structNext)
+		Loc_structNext->Waiting.PrevTimeout = Add_structTask;
+	Add_structTask->Waiting.Blocking = OS_TASK_BLOCKING_ENABLE;
+}
+
+/** OS_voidTimeoutRemove
+ * @brief Unlinks a task from the timeout list in O(1) (no effect if it is not there).
+ */
+void OS_voidTimeoutRemove(OS_structTask* Add_structTask){
+	if(Add_structTask->Waiting.Blocking != OS_TASK_BLOCKING_ENABLE)
+		return;
+	if(Add_structTask->Waiting.PrevTimeout)
+		Add_structTask->Waiting.PrevTimeout->Waiting.NextTimeout = Add_structTask->Waiting.NextTimeout;
+	else
+		OS_StructOS.TimeoutList = Add_structTask->Waiting.NextTimeout;
+	if(Add_structTask->Waiting.NextTimeout)
+		Add_structTask->Waiting.NextTimeout->Waiting.PrevTimeout = Add_structTask->Waiting.PrevTimeout;
+	Add_structTask->Waiting.NextTimeout = NULL;
+	Add_structTask->Waiting.PrevTimeout = NULL;
+	Add_structTask->Waiting.Blocking = OS_TASK_BLOCKING_DISABLE;
+}
+
+/** OS_voidBlockCurrentTask
+ * @brief Blocks the running task on a wait list, optionally for a limited number of ticks.
+ *
+ * Must be called from Handler Mode. The task resumes after OS_voidWakeTask or when the
+ * ticks elapse, Waiting.Result tells which one happened.
+ */
+void OS_voidBlockCurrentTask(OS_structTask** Add_structWaitList, u32 Copy_u32Ticks){
+	OS_structTask* Loc_structTask = OS_StructOS.CurrentTask;
+
+	Loc_structTask->TaskState = OS_TASK_WAITING;
+	Loc_structTask->Waiting.Result = OS_TASK_WAIT_TIMEOUT;
+	OS_voidWaitListInsert(Add_structWaitList, Loc_structTask);
+	if(Copy_u32Ticks != OS_WAIT_FOREVER)
+		OS_voidTimeoutInsert(Loc_structTask, Copy_u32Ticks);
+	OS_voidSchedule();
+}
+
+/** OS_voidWakeTask
+ * @brief Makes a task already popped from a wait list ready again.
+ *
+ * Must be called from Handler Mode, the caller decides when to reschedule.
+ */
+void OS_voidWakeTask(OS_structTask* Add_structTask){
+	OS_voidTimeoutRemove(Add_structTask);
+	Add_structTask->Waiting.Result = OS_TASK_WAIT_OK;
+	OS_MarkTaskReady(Add_structTask);
+}
+
+/** OS_voidWakeWaitListFromISR
+ * @brief Wakes the highest priority task of a wait list from an interrupt handler.
+ *
+ * Kernel data is protected by masking interrupts, so any ISR may call it.
+ */
+void OS_voidWakeWaitListFromISR(OS_structTask** Add_structWaitList){
+	u32 Loc_u32State;
+	OS_structTask* Loc_structTask;
+
+	OS_ENTER_CRITICAL(Loc_u32State);
+	Loc_structTask = OS_structWaitListPop(Add_structWaitList);
+	if(Loc_structTask){
+		OS_voidWakeTask(Loc_structTask);
+		OS_voidSchedule();
+	}
+	OS_EXIT_CRITICAL(Loc_u32State);
 }
 
 /** OS_voidSvcServices
@@ -211,14 +452,27 @@ void OS_voidDecideNext() {
  *   to run, and triggers a PendSV interrupt if the operating system is in running mode.
  * - SVC_WAITING: Suspends a task. Updates scheduler and ready queues.
  * - SVC_SUSPEND: Placeholder case for future expansion or specific handling of task suspension.
+ * - SVC_TERMINATE: Removes a terminated (or delayed) task from its ready queue and reschedules.
+ * - SVC_CREATE / SVC_DELETE: Create or delete a task while the OS runs, the status is written
+ *   through the pointer passed in R1.
+ * - SVC_SPAWN: Takes a task and a stack from the kernel pools and makes the task ready.
+ * - SVC_DELAY: Moves a task from the ready queues to the timeout list.
+ * - SVC_SEMAPHORE_ACQUIRE / SVC_SEMAPHORE_RELEASE: Take a semaphore (blocking with a timeout), give it back.
+ * - SVC_EVENT_WAIT / SVC_EVENT_SET: Block on an event group, wake its waiters.
+ * - SVC_COROUTINE_WAIT / SVC_COROUTINE_SIGNAL: Block a coroutine host, give a coroutine signal.
+ * - SVC_RWLOCK_READ / SVC_RWLOCK_WRITE / SVC_RWLOCK_UNLOCK: Block on a reader-writer lock, hand it to its waiters.
+ * - SVC_CONDVAR_WAIT / SVC_CONDVAR_SIGNAL: Release a mutex and wait on a condition variable, move its waiters to their mutex.
+ * - SVC_BARRIER_WAIT: Arrive at a barrier, blocking until its last task arrives.
+ * - SVC_ACTIVATE_BATCH: Activate several tasks with one scheduling decision.
+ * - SVC_SCHEDULER_UNLOCK: Take the scheduling decision deferred while the scheduler was locked.
+ * - SVC_SET_PRIORITY: Move a task to the ready queue or wait list position of a new priority.
  *
  * @param Add_u32StackFrame Pointer to the stack frame containing SVC parameters.
  *
  * @details
  * The function performs the following steps based on the SVC ID:
- * 1. Updates the scheduler table by sorting tasks based on priorities.
- * 2. Updates the ready queue with tasks ready to be scheduled.
- * 3. If the operating system is in running mode (`OS_RUNNING`):
+ * 1. Updates the ready queue with tasks ready to be scheduled.
+ * 2. If the operating system is in running mode (`OS_RUNNING`):
  *    - Decides the next task to run.
  *    - Triggers a PendSV interrupt to perform a context switch to the next task.
  *
@@ -236,53 +490,142 @@ void OS_voidDecideNext() {
 void OS_voidSvcServices(pu32 Add_u32StackFrame){
 	OS_structTask* task = (OS_structTask*)Add_u32StackFrame[0];
 	u8 SVC_ID = *((u8*)(((u8*)Add_u32StackFrame[6])-2));
+	u32 Loc_u32State;
+	OS_ENTER_CRITICAL(Loc_u32State);
 	switch(SVC_ID){
 		case SVC_ACTIVATE:/* Activate Task */
+			/* A ready or running task is already in the ready queues */
+			if((task->TaskState == OS_TASK_READY) || (task->TaskState == OS_TASK_RUNNING))
+				break;
+			/* A delayed or blocked task activated early leaves the timeout list and its wait list */
+			OS_voidTimeoutRemove(task);
+			OS_voidWaitListRemove(task);
 			OS_MarkTaskReady(task);
-			if(OS_StructOS.OS_enumMode == OS_RUNNING){
-				if(strcmp(OS_StructOS.CurrentTask->TaskName,"IDLE")!=0){
-					/* 3- What next? */
-					Global_u8Scheduler ^=1;
-					OS_voidDecideNext();
-					Global_u8Scheduler ^=1;
-					/* 4- Trigger PendSV */
-					if(OS_StructOS.NextTask && OS_StructOS.NextTask != OS_StructOS.CurrentTask)
-					OS_TRIGGER_PENDSV();
-
-				}
-			}
+			/* The idle task is only current here when OS_enumStartOS activates it, before the PSP
+			 * is set: the first switch waits for SysTick */
+			if(OS_StructOS.CurrentTask != &Global_structIdleTask)
+				OS_voidSchedule();
 			break;
 		case SVC_TERMINATE:/* Terminate Task */
-
+			OS_voidReadyQueueRemove(task);
+			OS_voidTimeoutRemove(task);
+			OS_voidWaitListRemove(task);
+			task->TaskState = OS_TASK_SUSPEND;
+			OS_voidSchedule();
 		break;
 		case SVC_WAITING:/* Suspend Task */
-			/* 1- Update waiting queue (scheduler table) */
-			OS_voidSortSchedulerTable();
-			/* 2- Update ready queue */
+			/* Update ready queue */
 			OS_voidUpdateReadyQueue();
 
 
 		break;
 		case SVC_SUSPEND:/* Suspend Task */
 		break;
+		case SVC_QUEUE_SEND:
+			OS_voidQueueSendService((OS_tstructQueue*)Add_u32StackFrame[0], (const void*)Add_u32StackFrame[1], Add_u32StackFrame[2]);
+		break;
+		case SVC_QUEUE_RECEIVE:
+			OS_voidQueueReceiveService((OS_tstructQueue*)Add_u32StackFrame[0], (void*)Add_u32StackFrame[1], Add_u32StackFrame[2]);
+		break;
+		case SVC_STREAM_WAIT:
+			OS_voidStreamBufferWaitService((OS_tstructStreamBuffer*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_STREAM_NOTIFY:
+			OS_voidStreamBufferNotifyService((OS_tstructStreamBuffer*)Add_u32StackFrame[0]);
+		break;
+		case SVC_PINGPONG_WAIT:
+			OS_voidPingPongWaitService((OS_tstructPingPong*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_POOL_ALLOC:
+			OS_voidPoolAllocService((OS_tstructPool*)Add_u32StackFrame[0], (void**)Add_u32StackFrame[1], Add_u32StackFrame[2]);
+		break;
+		case SVC_POOL_FREE:
+			OS_voidPoolFreeService((OS_tstructPool*)Add_u32StackFrame[0], (void*)Add_u32StackFrame[1]);
+		break;
+		case SVC_HEAP_ALLOC:
+			*(void**)Add_u32StackFrame[1] = OS_pvHeapAllocService(Add_u32StackFrame[0]);
+		break;
+		case SVC_HEAP_FREE:
+			OS_voidHeapFreeService((void*)Add_u32StackFrame[0]);
+		break;
+		case SVC_HEAP_STATS:
+			OS_voidHeapStatsService((OS_tstructHeapStats*)Add_u32StackFrame[0]);
+		break;
+		case SVC_CREATE:
+			*(OS_enumErrorStatus*)Add_u32StackFrame[1] = OS_enumCreateTaskService(task);
+		break;
+		case SVC_DELETE:
+			*(OS_enumErrorStatus*)Add_u32StackFrame[1] = OS_enumDeleteTaskService(task);
+		break;
+		case SVC_SPAWN:
+			OS_voidSpawnTaskService((OS_tstructSpawnRequest*)Add_u32StackFrame[0]);
+		break;
+		case SVC_DELAY:
+			OS_voidDelayTaskService(task, Add_u32StackFrame[1]);
+		break;
+		case SVC_SEMAPHORE_ACQUIRE:
+			*(OS_tenuSemaphoreState*)Add_u32StackFrame[2] = OS_enumAcquireSemaphoreService((OS_tstructSemaphore*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_SEMAPHORE_RELEASE:
+			*(OS_tenuSemaphoreState*)Add_u32StackFrame[1] = OS_enumReleaseSemaphoreService((OS_tstructSemaphore*)Add_u32StackFrame[0]);
+		break;
+		case SVC_EVENT_WAIT:
+			OS_voidEventWaitService((OS_tstructEvent*)Add_u32StackFrame[0], (OS_tstructEventWait*)Add_u32StackFrame[1], Add_u32StackFrame[2]);
+		break;
+		case SVC_EVENT_SET:
+			OS_voidEventSetService((OS_tstructEvent*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_COROUTINE_WAIT:
+			OS_voidCoroutineWaitService((OS_tstructCoroutineHost*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_COROUTINE_SIGNAL:
+			OS_voidCoroutineSignalService((OS_tstructCoroutineSignal*)Add_u32StackFrame[0]);
+		break;
+		case SVC_RWLOCK_READ:
+			*(OS_tenuRWLockState*)Add_u32StackFrame[2] = OS_enumRWLockReadService((OS_tstructRWLock*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_RWLOCK_WRITE:
+			*(OS_tenuRWLockState*)Add_u32StackFrame[2] = OS_enumRWLockWriteService((OS_tstructRWLock*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_RWLOCK_UNLOCK:
+			OS_voidRWLockUnlockService((OS_tstructRWLock*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_CONDVAR_WAIT:
+			OS_voidCondWaitService((OS_tstructCondVar*)Add_u32StackFrame[0], (OS_tstructSemaphore*)Add_u32StackFrame[1], Add_u32StackFrame[2]);
+		break;
+		case SVC_CONDVAR_SIGNAL:
+			OS_voidCondSignalService((OS_tstructCondVar*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_BARRIER_WAIT:
+			*(OS_tenuBarrierState*)Add_u32StackFrame[2] = OS_enumBarrierWaitService((OS_tstructBarrier*)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_ACTIVATE_BATCH:
+			OS_voidActivateTasksService((OS_structTask**)Add_u32StackFrame[0], Add_u32StackFrame[1]);
+		break;
+		case SVC_SCHEDULER_UNLOCK:
+			OS_voidSchedule();
+		break;
+		case SVC_SET_PRIORITY:
+			OS_voidSetPriorityService(task, Add_u32StackFrame[1]);
+		break;
 	}
+	OS_EXIT_CRITICAL(Loc_u32State);
 
 }
 /** OS_enumUpdateNoOfTicks
- * @brief Updates the tick count and handles task waiting based on blocking conditions.
+ * @brief Updates the tick count and wakes the tasks whose delay or timeout ended.
  *
- * This function iterates through the task table and decrements the tick count for tasks
- * that are in a blocking state. If a task's tick count reaches 1, it transitions the task
- * state to `OS_TASK_WAITING`, disables blocking, and requests a service to update the scheduler.
+ * Delayed tasks and tasks waiting on a kernel object with a timeout are in one timeout list
+ * sorted by wake tick, so only its head is checked: a tick with no expiry costs O(1) whatever
+ * the number of tasks.
  *
  * @details
- * The function performs the following steps for each task in the task table:
- * 1. Checks if the task's blocking mode is enabled (`OS_TASK_BLOCKING_ENABLE`).
- * 2. Decrements the tick count (`TicksCount`) for tasks that are blocking.
- * 3. If the tick count reaches 1:
- *    - Sets the task state to `OS_TASK_WAITING`.
- *    - Disables blocking for the task.
- *    - Requests a service (SVC_WAITING) to update the scheduler table.
+ * The function performs the following steps:
+ * 1. Increments `OS_StructOS.TickCount`.
+ * 2. While the head of the timeout list has reached its wake tick:
+ *    - Unlinks it from the timeout list (disables blocking).
+ *    - Unlinks it in O(1) from the wait list it is blocked on and sets `Waiting.Result` to timeout.
+ *    - Marks the task ready with `OS_MarkTaskReady` (already in Handler Mode, no SVC needed).
  *
  * Example usage:
  * @code
@@ -291,16 +634,17 @@ void OS_voidSvcServices(pu32 Add_u32StackFrame){
  * @endcode
  */
 void OS_enumUpdateNoOfTicks(){
-	for(u8 i=0 ; i<OS_StructOS.NoOfCreatedTasks;i++){
-		if(OS_StructOS.TaskTable[i]->Waiting.Blocking == OS_TASK_BLOCKING_ENABLE){
-			OS_StructOS.TaskTable[i]->Waiting.TicksCount--;
-			if(OS_StructOS.TaskTable[i]->Waiting.TicksCount == 1){
-				OS_StructOS.TaskTable[i]->TaskState = OS_TASK_WAITING;
-				OS_StructOS.TaskTable[i]->Waiting.Blocking = OS_TASK_BLOCKING_DISABLE;
-				/* Request waiting to SVC to update scheduler table */
-				OS_REQUEST_SERVICE(SVC_WAITING);
-			}
-		}
+	OS_structTask* Loc_structTask;
+
+	OS_StructOS.TickCount++;
+	while((Loc_structTask = OS_StructOS.TimeoutList) &&
+	      ((s32)(Loc_structTask->Waiting.WakeTick - OS_StructOS.TickCount) <= 0)){
+		OS_voidTimeoutRemove(Loc_structTask);
+		/* Timed out on a kernel object: leave its wait list */
+		OS_voidWaitListRemove(Loc_structTask);
+		Loc_structTask->Waiting.Result = OS_TASK_WAIT_TIMEOUT;
+		/* Already in Handler Mode, no need to request a service */
+		OS_MarkTaskReady(Loc_structTask);
 	}
 }
 /* LED for testing using Logic Analyzer */
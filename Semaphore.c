@@ -4,14 +4,17 @@
 /* Version : V01                                          */
 /* Email   : mohamedhamiid20@gmail.com                    */
 /**********************************************************/
-#include "FIFO.h"
+#include "STD_TYPES.h"
 #include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
 #include "Semaphore.h"
 /** OS_enumInitSemaphore
  * @brief Initializes a semaphore structure with initial values.
  *
- * This function initializes a semaphore structure with the specified number of available resources,
- * initializes the waiting queue, and sets other necessary parameters.
+ * This function initializes a semaphore structure with the specified number of available resources
+ * and an empty wait list.
  *
  * @param Add_structSemaphore Pointer to the semaphore structure to initialize.
  * @param Copy_u8NoOfAvailable Number of available resources for the semaphore.
@@ -20,118 +23,188 @@
  * @details
  * The function performs the following initialization steps:
  * 1. Sets the initial number of available resources (`s`) for the semaphore.
- * 2. Initializes the count of tasks waiting (`noOfWaiting`) to 0.
- * 3. Sets the current owner of the semaphore (`currentOwner`) to NULL.
- * 4. Initializes a FIFO queue (`Global_structWaitingQueue`) for tasks waiting on the semaphore.
+ * 2. Sets the current owner of the semaphore (`currentOwner`) to NULL.
+ * 3. Empties the wait list (`WaitList`), waiting tasks are linked through their own structure.
  *
  * Example usage:
  * @code
  * OS_tstructSemaphore mySemaphore;
  * OS_enumInitSemaphore(&mySemaphore, 5);
- * // Initializes 'mySemaphore' with 5 available resources and initializes the waiting queue.
+ * // Initializes 'mySemaphore' with 5 available resources.
  * @endcode
  */
 OS_tenuSemaphoreState OS_enumInitSemaphore(OS_tstructSemaphore* Add_structSemaphore, u8 Copy_u8NoOfAvailable){
 	Add_structSemaphore->s = Copy_u8NoOfAvailable ;
-	Add_structSemaphore->noOfWaiting = 0;
 	Add_structSemaphore->currentOwner = NULL;
-
-	OS_enumFifoInit (&(Add_structSemaphore->Global_structWaitingQueue),Add_structSemaphore->Global_structWaitingQueueFIFO , 100);
+	Add_structSemaphore->WaitList = NULL;
 
 	return OS_SEMAPHORE_INIT_OK;
 }
+/* Takes a resource with an exclusive access, 0 if none is available (interrupted tries are retried) */
+static inline u8 OS_u8SemaphoreTryTake(OS_tstructSemaphore* Add_structSemaphore){
+	u32 Loc_u32Value;
+	do{
+		Loc_u32Value = __LDREXW(&Add_structSemaphore->s);
+		if(!(Loc_u32Value & ~OS_SEMAPHORE_WAITERS)){
+			__CLREX();
+			return 0;
+		}
+	}while(__STREXW(Loc_u32Value - 1, &Add_structSemaphore->s));
+	__DMB();
+	return 1;
+}
+/* Gives a resource back with an exclusive access, 0 if tasks may be waiting (kernel needed) */
+static inline u8 OS_u8SemaphoreTryGive(OS_tstructSemaphore* Add_structSemaphore){
+	u32 Loc_u32Value;
+	__DMB();
+	do{
+		Loc_u32Value = __LDREXW(&Add_structSemaphore->s);
+		if(Loc_u32Value & OS_SEMAPHORE_WAITERS){
+			__CLREX();
+			return 0;
+		}
+	}while(__STREXW(Loc_u32Value + 1, &Add_structSemaphore->s));
+	return 1;
+}
 /**
- * @brief Attempts to acquire a semaphore for a given task.
+ * @brief Attempts to acquire a semaphore for the running task, waiting at most a number of ticks.
  *
- * This function attempts to acquire a semaphore for a specific task by decrementing the semaphore's
- * available resource count (`s`). If the semaphore is already acquired by the same task (`currentOwner`),
- * it returns OS_SEMAPHORE_ALREADY_ACQUIRED. If the semaphore's resources are insufficient (`s < 0`) and
- * tasks are waiting, it adds the task to the semaphore's waiting queue and terminates the task.
- * Otherwise, it assigns the semaphore to the current task as its owner.
+ * The fast path takes an available resource with LDREX / STREX: no SVC, no interrupt masking and
+ * no scheduler call. An exception between LDREX and STREX makes STREX fail, the try is repeated.
+ * Only a task that must wait enters the kernel through SVC_SEMAPHORE_ACQUIRE (slow path). If the
+ * task was blocked, `Waiting.Result` tells when it runs again whether the semaphore was handed to
+ * it or the wait timed out. From an interrupt handler the semaphore is only taken if available.
  *
  * @param Add_structSemaphore Pointer to the semaphore structure to acquire.
- * @param Add_structTask Pointer to the task attempting to acquire the semaphore.
+ * @param Copy_u32TicksToWait Ticks to wait, 0 to return at once or `OS_WAIT_FOREVER`.
  * @return OS_tenuSemaphoreState Returns OS_SEMAPHORE_ALREADY_ACQUIRED if the semaphore is already acquired
- *         by the same task, OS_SEMAPHORE_BUSY if the semaphore's resources are insufficient and tasks are waiting,
- *         or OS_SEMAPHORE_AVAILABLE if the semaphore is successfully acquired.
+ *         by the same task, OS_SEMAPHORE_AVAILABLE if the semaphore is acquired, OS_SEMAPHORE_BUSY if it is
+ *         not available and no wait was requested, or OS_SEMAPHORE_TIMEOUT if the wait timed out.
  *
  * @details
  * The function performs the following steps to acquire the semaphore:
- * 1. Decrements the available resource count (`s`) of the semaphore.
- * 2. Checks if the task already owns the semaphore (`currentOwner`). If true, returns OS_SEMAPHORE_ALREADY_ACQUIRED.
- * 3. If the semaphore's resources (`s`) are less than 0 and there are waiting tasks (`noOfWaiting` > 0):
- *    - Increments the count of waiting tasks.
- *    - Enqueues the task into the semaphore's waiting queue (`Global_structWaitingQueue`).
- *    - Terminates the task using `OS_enumTerminateTask`.
- *    - Returns OS_SEMAPHORE_BUSY.
- * 4. Otherwise, assigns the semaphore to the task as its owner (`currentOwner`).
- * 5. Returns OS_SEMAPHORE_AVAILABLE indicating successful acquisition.
+ * 1. Checks if the running task already owns the semaphore (`currentOwner`). If true, returns OS_SEMAPHORE_ALREADY_ACQUIRED.
+ * 2. Decrements the resource count (`s`) with LDREX / STREX if it is not 0, records the owner and
+ *    returns OS_SEMAPHORE_AVAILABLE.
+ * 3. Returns OS_SEMAPHORE_BUSY if no wait was requested or the caller is an interrupt handler.
+ * 4. Otherwise requests OS_enumAcquireSemaphoreService, which blocks the task.
  *
  * Example usage:
  * @code
  * OS_tstructSemaphore mySemaphore;
- * OS_structTask myTask;
- * OS_enumAcquireSemaphore(&mySemaphore, &myTask);
- * // Attempts to acquire 'mySemaphore' for 'myTask' and handles the semaphore state accordingly.
+ * OS_enumAcquireSemaphore(&mySemaphore, OS_WAIT_FOREVER);
+ * // Waits until 'mySemaphore' is acquired by the running task.
  * @endcode
  */
-OS_tenuSemaphoreState OS_enumAcquireSemaphore(OS_tstructSemaphore* Add_structSemaphore){
-	Add_structSemaphore->s--;
-	if(OS_StructOS.CurrentTask == Add_structSemaphore->currentOwner){
+OS_tenuSemaphoreState OS_enumAcquireSemaphore(OS_tstructSemaphore* Add_structSemaphore, u32 Copy_u32TicksToWait){
+	OS_tenuSemaphoreState Loc_enumState = OS_SEMAPHORE_BUSY;
+	u8 Loc_u8Handler = OS_IS_HANDLER_MODE();
+
+	if(!Loc_u8Handler && (OS_StructOS.CurrentTask == Add_structSemaphore->currentOwner)){
 		return OS_SEMAPHORE_ALREADY_ACQUIRED;
 	}
-	if (Add_structSemaphore->s < 0 && Add_structSemaphore->currentOwner) {
-		Add_structSemaphore->noOfWaiting++;
-		OS_enumFifoEnqueue(&(Add_structSemaphore->Global_structWaitingQueue), OS_StructOS.CurrentTask);
-		OS_enumTerminateTask(OS_StructOS.CurrentTask);
-		return OS_SEMAPHORE_BUSY;
+	/* Fast path */
+	if(OS_u8SemaphoreTryTake(Add_structSemaphore)){
+		if(!Loc_u8Handler)
+			Add_structSemaphore->currentOwner = OS_StructOS.CurrentTask;
+		return OS_SEMAPHORE_AVAILABLE;
 	}
-	else{
+	if(Loc_u8Handler || !Copy_u32TicksToWait)
+		return OS_SEMAPHORE_BUSY;
+
+	/* Slow path */
+	OS_REQUEST_SERVICE_ARGS(SVC_SEMAPHORE_ACQUIRE, Add_structSemaphore, Copy_u32TicksToWait, &Loc_enumState);
+	/* Blocked: handed over by a release, or timed out */
+	if(Loc_enumState == OS_SEMAPHORE_BUSY)
+		Loc_enumState = (OS_StructOS.CurrentTask->Waiting.Result == OS_TASK_WAIT_OK) ? OS_SEMAPHORE_AVAILABLE : OS_SEMAPHORE_TIMEOUT;
+	return Loc_enumState;
+}
+/** OS_enumAcquireSemaphoreService
+ * @brief Slow path of OS_enumAcquireSemaphore, runs in Handler Mode with interrupts masked.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Takes a resource released since the fast path failed, if any, and returns OS_SEMAPHORE_AVAILABLE.
+ * 2. Otherwise sets OS_SEMAPHORE_WAITERS, so the next release enters the kernel, and blocks the task
+ *    on the wait list (`WaitList`) with `OS_voidBlockCurrentTask`, which also inserts it in the
+ *    timeout list unless it waits forever.
+ * 3. Returns OS_SEMAPHORE_BUSY.
+ *
+ * A task in the middle of a fast path (between LDREX and STREX) was interrupted by this SVC, its
+ * STREX fails and it reads the new value of `s`.
+ */
+OS_tenuSemaphoreState OS_enumAcquireSemaphoreService(OS_tstructSemaphore* Add_structSemaphore, u32 Copy_u32TicksToWait){
+	if(Add_structSemaphore->s & ~OS_SEMAPHORE_WAITERS){
+		Add_structSemaphore->s--;
 		Add_structSemaphore->currentOwner = OS_StructOS.CurrentTask;
+		return OS_SEMAPHORE_AVAILABLE;
 	}
-	return OS_SEMAPHORE_AVAILABLE;
+	Add_structSemaphore->s |= OS_SEMAPHORE_WAITERS;
+	OS_voidBlockCurrentTask(&Add_structSemaphore->WaitList, Copy_u32TicksToWait);
+	return OS_SEMAPHORE_BUSY;
 }
 /**
- * @brief Releases a semaphore, allowing the next waiting task to acquire it.
+ * @brief Releases a semaphore, allowing the highest priority waiting task to acquire it.
  *
- * This function releases a semaphore by incrementing its available resource count (`s`).
- * If there are tasks waiting on the semaphore (`noOfWaiting > 0`), it dequeues the next task
- * from the semaphore's waiting queue (`Global_structWaitingQueue`), assigns it as the current owner
- * of the semaphore, activates the task using `OS_enumActivateTask`, and returns OS_SEMAPHORE_AVAILABLE.
- * If no tasks are waiting (`noOfWaiting <= 0`), it returns OS_SEMAPHORE_BUSY indicating that the semaphore
- * is still in use.
+ * Without waiting tasks the resource count is incremented with LDREX / STREX (fast path). When
+ * OS_SEMAPHORE_WAITERS is set, the work is done by OS_enumReleaseSemaphoreService: through
+ * SVC_SEMAPHORE_RELEASE from a task, directly with interrupts masked from an interrupt handler.
  *
  * @param Add_structSemaphore Pointer to the semaphore structure to release.
- * @return OS_tenuSemaphoreState Returns OS_SEMAPHORE_AVAILABLE if a task was successfully dequeued and assigned
- *         as the semaphore's owner, or OS_SEMAPHORE_BUSY if no tasks are waiting.
- *
- * @details
- * The function performs the following steps to release the semaphore:
- * 1. Increments the available resource count (`s`) of the semaphore.
- * 2. Checks if there are tasks waiting (`noOfWaiting > 0`).
- *    - Decreases the count of waiting tasks (`noOfWaiting`).
- *    - Dequeues the next task from the semaphore's waiting queue.
- *    - Sets the dequeued task as the current owner of the semaphore (`currentOwner`).
- *    - Activates the dequeued task using `OS_enumActivateTask`.
- *    - Returns OS_SEMAPHORE_AVAILABLE.
- * 3. If no tasks are waiting (`noOfWaiting <= 0`), returns OS_SEMAPHORE_BUSY.
+ * @return OS_tenuSemaphoreState Returns OS_SEMAPHORE_AVAILABLE if a waiting task got the semaphore,
+ *         or OS_SEMAPHORE_BUSY if no tasks are waiting.
  *
  * Example usage:
  * @code
  * OS_tstructSemaphore mySemaphore;
  * OS_enumReleaseSemaphore(&mySemaphore);
- * // Releases 'mySemaphore', allowing the next waiting task to acquire it if available.
+ * // Releases 'mySemaphore', the highest priority waiting task acquires it if any.
  * @endcode
  */
 OS_tenuSemaphoreState OS_enumReleaseSemaphore(OS_tstructSemaphore* Add_structSemaphore){
-	OS_structTask* loc_structDequeuedTask;
-	Add_structSemaphore->s++ ;
-	if (Add_structSemaphore->s <= 0) {
-		Add_structSemaphore->noOfWaiting--;
-		OS_enumFifoDequeue(&(Add_structSemaphore->Global_structWaitingQueue), &loc_structDequeuedTask);
+	OS_tenuSemaphoreState Loc_enumState;
+	u32 Loc_u32State;
+
+	/* Fast path */
+	Add_structSemaphore->currentOwner = NULL;
+	if(OS_u8SemaphoreTryGive(Add_structSemaphore))
+		return OS_SEMAPHORE_BUSY;
+
+	/* Slow path */
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		Loc_enumState = OS_enumReleaseSemaphoreService(Add_structSemaphore);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_SEMAPHORE_RELEASE, Add_structSemaphore, &Loc_enumState, 0);
+	}
+	return Loc_enumState;
+}
+/** OS_enumReleaseSemaphoreService
+ * @brief Slow path of OS_enumReleaseSemaphore, runs in Handler Mode with interrupts masked.
+ *
+ * @details
+ * The function performs the following steps to release the semaphore:
+ * 1. Pops the highest priority waiting task, if any:
+ *    - Sets it as the current owner of the semaphore (`currentOwner`), the resource goes to it directly.
+ *    - Clears OS_SEMAPHORE_WAITERS once the wait list is empty.
+ *    - Wakes it with `OS_voidWakeTask` (it leaves the timeout list in O(1)) and reschedules.
+ *    - Returns OS_SEMAPHORE_AVAILABLE.
+ * 2. Otherwise (the waiters timed out or were deleted), clears OS_SEMAPHORE_WAITERS, increments the
+ *    resource count (`s`) and returns OS_SEMAPHORE_BUSY.
+ */
+OS_tenuSemaphoreState OS_enumReleaseSemaphoreService(OS_tstructSemaphore* Add_structSemaphore){
+	OS_structTask* loc_structDequeuedTask = OS_structWaitListPop(&Add_structSemaphore->WaitList);
+
+	if (loc_structDequeuedTask) {
 		Add_structSemaphore->currentOwner = loc_structDequeuedTask;
-		OS_enumActivateTask(loc_structDequeuedTask);
+		if(!Add_structSemaphore->WaitList)
+			Add_structSemaphore->s &= ~OS_SEMAPHORE_WAITERS;
+		OS_voidWakeTask(loc_structDequeuedTask);
+		OS_voidSchedule();
 		return OS_SEMAPHORE_AVAILABLE;
 	}
+	Add_structSemaphore->s = (Add_structSemaphore->s & ~OS_SEMAPHORE_WAITERS) + 1;
 	return OS_SEMAPHORE_BUSY;
 }
@@ -0,0 +1,172 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Lock-free byte stream from one producer (usually   */
+/*           an ISR) to one consumer task                       */
+/****************************************************************/
+#include <string.h>
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "System.h"
+#include "Scheduler.h"
+#include "Porting_CortexM.h"
+#include "StreamBuffer.h"
+
+/* Number of bytes published by the producer and not released by the consumer yet */
+static inline u32 OS_u32StreamBufferAvailable(const OS_tstructStreamBuffer* Add_structStream){
+	return Add_structStream->WriteIndex - Add_structStream->ReadIndex;
+}
+
+/** OS_enumStreamBufferCreate
+ * @brief Initializes a stream buffer over a user provided byte array.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Checks the storage is not NULL, its size is a power of two and the trigger level fits in it.
+ * 2. Resets both indices and the reader wait list.
+ */
+OS_tenuStreamState OS_enumStreamBufferCreate(OS_tstructStreamBuffer* Add_structStream, u8* Add_u8Buffer, u32 Copy_u32Size, u32 Copy_u32TriggerLevel){
+	if(!Add_u8Buffer || !Copy_u32Size || (Copy_u32Size & (Copy_u32Size - 1)) || (Copy_u32TriggerLevel > Copy_u32Size))
+		return OS_STREAM_INIT_ERROR;
+
+	Add_structStream->Buffer = Add_u8Buffer;
+	Add_structStream->Mask = Copy_u32Size - 1;
+	Add_structStream->TriggerLevel = Copy_u32TriggerLevel ? Copy_u32TriggerLevel : 1;
+	Add_structStream->WriteIndex = 0;
+	Add_structStream->ReadIndex = 0;
+	Add_structStream->ReaderWaitList = NULL;
+
+	return OS_STREAM_INIT_OK;
+}
+
+/** OS_u32StreamBufferAcquireWrite
+ * @brief Returns the contiguous free span starting at the write position.
+ *
+ * The span stops at the end of the storage, after committing it the producer may acquire
+ * again to get the part wrapping to the start.
+ */
+u32 OS_u32StreamBufferAcquireWrite(OS_tstructStreamBuffer* Add_structStream, u8** Add_pu8Span){
+	u32 Loc_u32Index = Add_structStream->WriteIndex & Add_structStream->Mask;
+	u32 Loc_u32Free  = (Add_structStream->Mask + 1) - OS_u32StreamBufferAvailable(Add_structStream);
+	u32 Loc_u32ToEnd = (Add_structStream->Mask + 1) - Loc_u32Index;
+
+	*Add_pu8Span = &Add_structStream->Buffer[Loc_u32Index];
+	return (Loc_u32Free < Loc_u32ToEnd) ? Loc_u32Free : Loc_u32ToEnd;
+}
+
+/** OS_voidStreamBufferCommit
+ * @brief Publishes written bytes and wakes the reader once the trigger level is reached.
+ *
+ * @details
+ * 1. A memory barrier makes the data visible before the new write index.
+ * 2. The write index is advanced, this is the only store the producer does on shared state.
+ * 3. Only if a reader is blocked and the trigger level is reached the kernel is entered:
+ *    directly from an ISR, through SVC_STREAM_NOTIFY from a task.
+ */
+void OS_voidStreamBufferCommit(OS_tstructStreamBuffer* Add_structStream, u32 Copy_u32Length){
+	__DMB();
+	Add_structStream->WriteIndex += Copy_u32Length;
+	__DMB();
+
+	if(Add_structStream->ReaderWaitList && (OS_u32StreamBufferAvailable(Add_structStream) >= Add_structStream->TriggerLevel)){
+		if(OS_IS_HANDLER_MODE())
+			OS_voidStreamBufferNotifyService(Add_structStream);
+		else
+			OS_REQUEST_SERVICE_ARGS(SVC_STREAM_NOTIFY, Add_structStream, 0, 0);
+	}
+}
+
+/** OS_u32StreamBufferSend
+ * @brief Copies bytes into the buffer (in up to two spans), the reader is notified once at the end.
+ */
+u32 OS_u32StreamBufferSend(OS_tstructStreamBuffer* Add_structStream, const void* Add_voidData, u32 Copy_u32Length){
+	const u8* Loc_u8Data = (const u8*)Add_voidData;
+	u32 Loc_u32Copied = 0;
+	u32 Loc_u32Span;
+	u8* Loc_u8Span;
+
+	while(Loc_u32Copied < Copy_u32Length){
+		Loc_u32Span = OS_u32StreamBufferAcquireWrite(Add_structStream, &Loc_u8Span);
+		if(!Loc_u32Span)
+			break;
+		if(Loc_u32Span > (Copy_u32Length - Loc_u32Copied))
+			Loc_u32Span = Copy_u32Length - Loc_u32Copied;
+		memcpy(Loc_u8Span, &Loc_u8Data[Loc_u32Copied], Loc_u32Span);
+		Loc_u32Copied += Loc_u32Span;
+		__DMB();
+		Add_structStream->WriteIndex += Loc_u32Span;
+	}
+	/* Nothing more to publish, only check the trigger level */
+	OS_voidStreamBufferCommit(Add_structStream, 0);
+	return Loc_u32Copied;
+}
+
+/** OS_u32StreamBufferAcquireRead
+ * @brief Returns the contiguous span of available bytes, waiting for the trigger level.
+ */
+u32 OS_u32StreamBufferAcquireRead(OS_tstructStreamBuffer* Add_structStream, const u8** Add_pu8Span, u32 Copy_u32TicksToWait){
+	u32 Loc_u32Index, Loc_u32Available, Loc_u32ToEnd;
+
+	if((OS_u32StreamBufferAvailable(Add_structStream) < Add_structStream->TriggerLevel) && Copy_u32TicksToWait)
+		OS_REQUEST_SERVICE_ARGS(SVC_STREAM_WAIT, Add_structStream, Copy_u32TicksToWait, 0);
+
+	Loc_u32Available = OS_u32StreamBufferAvailable(Add_structStream);
+	__DMB();
+	Loc_u32Index = Add_structStream->ReadIndex & Add_structStream->Mask;
+	Loc_u32ToEnd = (Add_structStream->Mask + 1) - Loc_u32Index;
+
+	*Add_pu8Span = &Add_structStream->Buffer[Loc_u32Index];
+	return (Loc_u32Available < Loc_u32ToEnd) ? Loc_u32Available : Loc_u32ToEnd;
+}
+
+/** OS_voidStreamBufferRelease
+ * @brief Gives consumed bytes back to the producer, the only store the consumer does on shared state.
+ */
+void OS_voidStreamBufferRelease(OS_tstructStreamBuffer* Add_structStream, u32 Copy_u32Length){
+	__DMB();
+	Add_structStream->ReadIndex += Copy_u32Length;
+}
+
+/** OS_u32StreamBufferReceive
+ * @brief Copies available bytes out of the buffer (in up to two spans).
+ */
+u32 OS_u32StreamBufferReceive(OS_tstructStreamBuffer* Add_structStream, void* Add_voidData, u32 Copy_u32MaxLength, u32 Copy_u32TicksToWait){
+	u8* Loc_u8Data = (u8*)Add_voidData;
+	u32 Loc_u32Copied = 0;
+	u32 Loc_u32Span;
+	const u8* Loc_u8Span;
+
+	while(Loc_u32Copied < Copy_u32MaxLength){
+		/* Only the first span may block */
+		Loc_u32Span = OS_u32StreamBufferAcquireRead(Add_structStream, &Loc_u8Span, Loc_u32Copied ? 0 : Copy_u32TicksToWait);
+		if(!Loc_u32Span)
+			break;
+		if(Loc_u32Span > (Copy_u32MaxLength - Loc_u32Copied))
+			Loc_u32Span = Copy_u32MaxLength - Loc_u32Copied;
+		memcpy(&Loc_u8Data[Loc_u32Copied], Loc_u8Span, Loc_u32Span);
+		OS_voidStreamBufferRelease(Add_structStream, Loc_u32Span);
+		Loc_u32Copied += Loc_u32Span;
+	}
+	return Loc_u32Copied;
+}
+
+/** OS_voidStreamBufferWaitService
+ * @brief Kernel side of the blocking read, runs in Handler Mode.
+ *
+ * The trigger level is checked again with interrupts masked so a commit done between the
+ * task's check and the SVC is not missed.
+ */
+void OS_voidStreamBufferWaitService(OS_tstructStreamBuffer* Add_structStream, u32 Copy_u32TicksToWait){
+	if(OS_u32StreamBufferAvailable(Add_structStream) < Add_structStream->TriggerLevel)
+		OS_voidBlockCurrentTask((OS_structTask**)&Add_structStream->ReaderWaitList, Copy_u32TicksToWait);
+}
+
+/** OS_voidStreamBufferNotifyService
+ * @brief Wakes the blocked reader if the trigger level is reached, runs in Handler Mode.
+ */
+void OS_voidStreamBufferNotifyService(OS_tstructStreamBuffer* Add_structStream){
+	if(OS_u32StreamBufferAvailable(Add_structStream) >= Add_structStream->TriggerLevel)
+		OS_voidWakeWaitListFromISR((OS_structTask**)&Add_structStream->ReaderWaitList);
+}
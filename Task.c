@@ -7,34 +7,86 @@
 /********************************************************************/
 #include <string.h>
 #include <STD_TYPES.h>
-#include "FIFO.h"
 #include "System.h"
 #include "Mem_Management.h"
 #include "Scheduler.h"
 #include "Porting_CortexM.h"
 #include "MyRTOSConfig.h"
 #include "Task.h"
+#include "BasicTask.h"
 extern OS_structTask Global_structIdleTask;
 
-extern OS_tBuffer Global_structReadyQueue[OS_TASK_PRIORITY_LEVELS]; // 8 * 32 = 256
-extern OS_structTask* Global_structReadyQueueFIFO[OS_TASK_PRIORITY_LEVELS][5];
+extern OS_tstructReadyQueue Global_structReadyQueue[OS_TASK_PRIORITY_LEVELS];
+
+/* Task structures of OS_enumSpawnTask, free ones are linked through AllTasks.Next */
+static OS_structTask Global_structTaskPool[OS_TASK_POOL_SIZE];
+static OS_structTask* Global_structTaskPoolFree;
+
+#define OS_IS_POOL_TASK(task)  (((task) >= &Global_structTaskPool[0]) && ((task) < &Global_structTaskPool[OS_TASK_POOL_SIZE]))
+/* A created task is linked in TaskList: either it has a previous task or it is the first one */
+#define OS_IS_CREATED_TASK(task) (((task)->AllTasks.Prev != NULL) || (OS_StructOS.TaskList == (task)))
+
+/* Gives the stack of a deleted task back, and its structure to the task pool if it came from it */
+static void OS_voidFreeTask(OS_structTask* Add_structTask){
+	OS_voidStackFree(Add_structTask);
+	if(OS_IS_POOL_TASK(Add_structTask)){
+		Add_structTask->AllTasks.Next = Global_structTaskPoolFree;
+		Global_structTaskPoolFree = Add_structTask;
+	}
+}
+/* Frees the task that deleted itself once another task runs (PendSV saved its context) */
+static void OS_voidReclaimDeletedTask(){
+	if(!OS_StructOS.DeletedTask || (OS_StructOS.DeletedTask == OS_StructOS.CurrentTask))
+		return;
+	OS_voidFreeTask(OS_StructOS.DeletedTask);
+	OS_StructOS.DeletedTask = NULL;
+}
+/* Builds the stack frame of a task that got its stack, links it in the list of created tasks
+ * and suspends it (steps 3 to 7 of OS_enumCreateTask) */
+static void OS_voidLinkCreatedTask(OS_structTask* Add_structTask){
+	// Create Stack
+	OS_enumCreateStack(Add_structTask);
+
+	// The structure may belong to a deleted task
+	Add_structTask->Waiting.Blocking = OS_TASK_BLOCKING_DISABLE;
+	Add_structTask->Waiting.NextWaiter = NULL;
+	Add_structTask->Waiting.WaitLink = NULL;
+	Add_structTask->Waiting.WaitHead = NULL;
+	Add_structTask->Ready.Next = NULL;
+	Add_structTask->Ready.Prev = NULL;
+
+	// Add task to the list of created tasks
+	Add_structTask->AllTasks.Prev = NULL;
+	Add_structTask->AllTasks.Next = OS_StructOS.TaskList;
+	if(OS_StructOS.TaskList)
+		OS_StructOS.TaskList->AllTasks.Prev = Add_structTask;
+	OS_StructOS.TaskList = Add_structTask;
+	OS_StructOS.NoOfCreatedTasks++;
+	// Task State Update --> Suspend
+	Add_structTask->TaskState = OS_TASK_SUSPEND;
+}
 /** OS_enumCreateTask
  * @brief Creates a new task and initializes its stack and state.
  *
  * This function creates a new task by allocating and configuring its stack,
- * adding it to the scheduler table (TaskTable), and updating its state to suspended.
+ * adding it to the list of created tasks, and updating its state to suspended.
+ * Once the OS runs, a task creates other tasks through SVC_CREATE.
  *
  * @param Add_structTask Pointer to the task structure to create and initialize.
- * @return OS_enumErrorStatus Returns OS_OK indicating successful task creation.
+ * @return OS_enumErrorStatus Returns OS_OK indicating successful task creation,
+ *         OS_EXCEED_AVAILABLE_STACK if no stack is available or TASK_CREATION_ERROR if the
+ *         task is already created.
  *
  * @details
- * The function performs the following steps to create a task:
- * 1. Allocates stack space for the task and checks it does not exceed the PSP stack limit.
- * 2. Aligns the stack space with an 8-byte padding to ensure proper memory alignment.
+ * The function performs the following steps to create a task (OS_enumCreateTaskService):
+ * 1. Checks the task is not already created (or deleted but not reclaimed yet).
+ * 2. Allocates a stack of the task's size class using `OS_enumStackAlloc`, reusing the stack of a
+ *    deleted task when possible and checking the process stack region limit otherwise.
  * 3. Creates the stack using `OS_enumCreateStack`.
- * 4. Adds the task to the scheduler table (`TaskTable`) of the operating system.
- * 5. Increments the count of created tasks (`NoOfCreatedTasks`).
- * 6. Sets the initial state of the task to suspended (`TaskState = OS_TASK_SUSPEND`).
+ * 4. Clears the waiting information left by a previous use of the task structure.
+ * 5. Links the task at the head of the list of created tasks (`TaskList`) in O(1).
+ * 6. Increments the count of created tasks (`NoOfCreatedTasks`).
+ * 7. Sets the initial state of the task to suspended (`TaskState = OS_TASK_SUSPEND`).
  *
  * Example usage:
  * @code
@@ -51,40 +103,211 @@ extern OS_structTask* Global_structReadyQueueFIFO[OS_TASK_PRIORITY_LEVELS][5];
  */
 OS_enumErrorStatus OS_enumCreateTask(OS_structTask* Add_structTask){
 	OS_enumErrorStatus Error = OS_OK;
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		Error = OS_enumCreateTaskService(Add_structTask);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else if(OS_StructOS.OS_enumMode == OS_RUNNING){
+		OS_REQUEST_SERVICE_ARGS(SVC_CREATE, Add_structTask, &Error, 0);
+	}
+	else{
+		Error = OS_enumCreateTaskService(Add_structTask);
+	}
+	return Error;
+}
+/** OS_enumCreateTaskService
+ * @brief Kernel side of OS_enumCreateTask, see its steps.
+ */
+OS_enumErrorStatus OS_enumCreateTaskService(OS_structTask* Add_structTask){
+	OS_enumErrorStatus Error;
+
+	OS_voidReclaimDeletedTask();
+	if(OS_IS_CREATED_TASK(Add_structTask) || (Add_structTask == OS_StructOS.DeletedTask))
+		return TASK_CREATION_ERROR;
 
 	// Allocate stack
-	// Check it's not exceeding the PSP Stack
-	Add_structTask->_S_PSP_Task = OS_StructOS.PSP_LastEnd;
-	Add_structTask->_E_PSP_Task = Add_structTask->_S_PSP_Task - Add_structTask->StackSize;
-	/* Check not done yet */
+	Error = OS_enumStackAlloc(Add_structTask);
+	if(Error != OS_OK)
+		return Error;
 
-	// Align 8 bytes padding between the task and others
-	OS_StructOS.PSP_LastEnd = Add_structTask->_E_PSP_Task - OS_STACK_PADDING ;
+	OS_voidLinkCreatedTask(Add_structTask);
 
-	// Create Stack
-	OS_enumCreateStack(Add_structTask);
+	return OS_OK;
+}
+/** OS_enumDeleteTask
+ * @brief Deletes a task and reclaims its stack.
+ *
+ * The task is removed from every kernel list, its stack is given back to the stack allocator
+ * and it is unlinked from the list of created tasks in O(1), so the task structure itself can be
+ * given to OS_enumCreateTask again (tasks of the task pool go back to the pool). A task may delete
+ * itself, it never runs again.
+ *
+ * @param Add_structTask Pointer to the task to delete.
+ * @return OS_enumErrorStatus OS_OK, or TASK_CREATION_ERROR if the task is the idle task or was
+ *         not created.
+ *
+ * @details
+ * The function performs the following steps (OS_enumDeleteTaskService):
+ * 1. Reclaims a task that deleted itself before, then refuses the idle task and tasks that are
+ *    not created.
+ * 2. Removes the task from its ready queue, from the timeout list and from the kernel object wait
+ *    list it is blocked on, all in O(1).
+ * 3. Unlinks the task from the list of created tasks.
+ * 4. Frees its stack with `OS_voidStackFree` and gives pool tasks back to the task pool. A task
+ *    deleting itself keeps both until the context switch saved its registers on them, it is kept
+ *    in `DeletedTask` and reclaimed by the next create, spawn or delete.
+ * 5. Reschedules, so a task deleting itself is switched out at once.
+ *
+ * NOTE: Semaphores held by the task are not released.
+ *
+ * Example usage:
+ * @code
+ * void connectionHandler(){
+ *     // Serve the connection
+ *     OS_enumDeleteTask(OS_StructOS.CurrentTask);
+ * }
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumDeleteTask(OS_structTask* Add_structTask){
+	OS_enumErrorStatus Error = OS_OK;
+	u32 Loc_u32State;
 
-	// Add task to Scheduler table (Waiting Queue)
-	OS_StructOS.TaskTable[OS_StructOS.NoOfCreatedTasks++] = Add_structTask;
-	// Task State Update --> Suspend
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		Error = OS_enumDeleteTaskService(Add_structTask);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_DELETE, Add_structTask, &Error, 0);
+	}
+	return Error;
+}
+/** OS_enumDeleteTaskService
+ * @brief Kernel side of OS_enumDeleteTask, see its steps.
+ */
+OS_enumErrorStatus OS_enumDeleteTaskService(OS_structTask* Add_structTask){
+	OS_voidReclaimDeletedTask();
+	if((Add_structTask == &Global_structIdleTask) || !OS_IS_CREATED_TASK(Add_structTask))
+		return TASK_CREATION_ERROR;
+
+	// Leave every kernel list
+	if(Add_structTask->TaskState == OS_TASK_READY)
+		OS_voidReadyQueueRemove(Add_structTask);
+	OS_voidTimeoutRemove(Add_structTask);
+	OS_voidWaitListRemove(Add_structTask);
 	Add_structTask->TaskState = OS_TASK_SUSPEND;
 
-	return Error;
+	// Unlink it from the list of created tasks
+	if(Add_structTask->AllTasks.Prev)
+		Add_structTask->AllTasks.Prev->AllTasks.Next = Add_structTask->AllTasks.Next;
+	else
+		OS_StructOS.TaskList = Add_structTask->AllTasks.Next;
+	if(Add_structTask->AllTasks.Next)
+		Add_structTask->AllTasks.Next->AllTasks.Prev = Add_structTask->AllTasks.Prev;
+	Add_structTask->AllTasks.Next = NULL;
+	Add_structTask->AllTasks.Prev = NULL;
+	OS_StructOS.NoOfCreatedTasks--;
+
+	// Free its stack (and pool entry), PendSV still saves the context of the running task on them
+	if(Add_structTask == OS_StructOS.CurrentTask)
+		OS_StructOS.DeletedTask = Add_structTask;
+	else
+		OS_voidFreeTask(Add_structTask);
+
+	OS_voidSchedule();
+	return OS_OK;
+}
+/** OS_enumSpawnTask
+ * @brief Creates and activates a task using a task structure and a stack owned by the kernel.
+ *
+ * @param func              Function of the task.
+ * @param Copy_u8Priority   Priority of the task (below `OS_TASK_PRIORITY_LEVELS`).
+ * @param Copy_u8StackClass Stack size class, the stack is 2^(OS_STACK_MIN_CLASS_LOG2 + class) bytes.
+ * @param Add_pstructTask   Receives the spawned task, may be NULL.
+ * @return OS_enumErrorStatus OS_OK, TASK_CREATION_ERROR if the task pool is empty or an argument
+ *         is out of range, or OS_EXCEED_AVAILABLE_STACK if no stack of the class is left.
+ *
+ * @details
+ * The function performs the following steps (OS_voidSpawnTaskService):
+ * 1. Reclaims a task that deleted itself before.
+ * 2. Pops a task structure from the task pool free list.
+ * 3. Fills it, takes a stack of the class from the stack pool with `OS_enumStackPoolAlloc` and
+ *    creates it (stack frame, list of created tasks) like `OS_enumCreateTask`.
+ * 4. Marks it ready and reschedules, a spawned task with a higher priority runs at once.
+ */
+OS_enumErrorStatus OS_enumSpawnTask(void (*func)(void), u8 Copy_u8Priority, u8 Copy_u8StackClass, OS_structTask** Add_pstructTask){
+	OS_tstructSpawnRequest Loc_structRequest = {func, Copy_u8Priority, Copy_u8StackClass, NULL, OS_OK};
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE() || (OS_StructOS.OS_enumMode != OS_RUNNING)){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidSpawnTaskService(&Loc_structRequest);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_SPAWN, &Loc_structRequest, 0, 0);
+	}
+	if(Add_pstructTask)
+		*Add_pstructTask = Loc_structRequest.Task;
+	return Loc_structRequest.Status;
+}
+/** OS_voidSpawnTaskService
+ * @brief Kernel side of OS_enumSpawnTask, see its steps.
+ */
+void OS_voidSpawnTaskService(OS_tstructSpawnRequest* Add_structRequest){
+	OS_structTask* Loc_structTask;
+
+	Add_structRequest->Task = NULL;
+	OS_voidReclaimDeletedTask();
+	if(!Add_structRequest->func || (Add_structRequest->Priority >= OS_TASK_PRIORITY_LEVELS)
+			|| (Add_structRequest->StackClass >= OS_STACK_NO_OF_CLASSES) || !Global_structTaskPoolFree){
+		Add_structRequest->Status = TASK_CREATION_ERROR;
+		return;
+	}
+
+	// Take a task structure from the pool
+	Loc_structTask = Global_structTaskPoolFree;
+	Global_structTaskPoolFree = Loc_structTask->AllTasks.Next;
+	Loc_structTask->AllTasks.Next = NULL;
+	Loc_structTask->func = Add_structRequest->func;
+	Loc_structTask->Priority = Add_structRequest->Priority;
+	Loc_structTask->PreemptionThreshold = 0;
+	Loc_structTask->StackSize = 1UL << (Add_structRequest->StackClass + OS_STACK_MIN_CLASS_LOG2);
+	Loc_structTask->AutoStart = AutoStart;
+	strcpy(Loc_structTask->TaskName , "Spawned");
+
+	// Take a stack of the class from the stack pool and create the task
+	Add_structRequest->Status = OS_enumStackPoolAlloc(Loc_structTask);
+	if(Add_structRequest->Status != OS_OK){
+		Loc_structTask->AllTasks.Next = Global_structTaskPoolFree;
+		Global_structTaskPoolFree = Loc_structTask;
+		return;
+	}
+	OS_voidLinkCreatedTask(Loc_structTask);
+
+	// Make it ready
+	OS_MarkTaskReady(Loc_structTask);
+	OS_voidSchedule();
+	Add_structRequest->Task = Loc_structTask;
 }
 /** OS_enumActivateTask
- * @brief Activates a suspended task, changing its state to waiting.
+ * @brief Activates a suspended, delayed or blocked task, making it ready.
  *
- * This function activates a suspended task by changing its state from suspended
- * (`OS_TASK_SUSPEND`) to waiting (`OS_TASK_WAITING`). It then requests activation
- * of the task via a service call to the operating system.
+ * This function requests activation of the task via a service call to the operating
+ * system. A task blocked on a kernel object leaves its wait list and its wait returns
+ * a timeout. A task already ready or running is left as it is.
  *
  * @param Add_structTask Pointer to the task structure to activate.
  * @return OS_enumErrorStatus Returns OS_OK indicating successful task activation.
  *
  * @details
  * The function performs the following steps to activate a task:
- * 1. Changes the state of the task from suspended to waiting (`TaskState = OS_TASK_WAITING`).
- * 2. Requests activation of the task by calling `OS_REQUEST_SERVICE(SVC_ACTIVATE)`.
+ * 1. Requests activation of the task through `SVC_ACTIVATE`, which skips a ready or running task.
+ * 2. Removes the task from the timeout list and from the wait list it is blocked on, in O(1).
+ * 3. Marks it ready and decides the next task, triggering PendSV if it preempts the caller.
  *
  * Example usage:
  * @code
@@ -101,77 +324,208 @@ OS_enumErrorStatus OS_enumCreateTask(OS_structTask* Add_structTask){
  * if(loc_enumERROR != OS_OK)
  * 		while(1);
  *
- * // Activates 'myTask' by changing its state to waiting and requesting activation via SVC.
+ * // Activates 't1' by requesting activation via SVC.
  * @endcode
  */
 OS_enumErrorStatus OS_enumActivateTask(OS_structTask* Add_structTask){
-	/* Change State from Suspend to Waiting */
-	Add_structTask->TaskState = OS_TASK_WAITING ;
+	/* Request activate to SVC, the kernel checks the state of the task */
+	OS_REQUEST_SERVICE_ARGS(SVC_ACTIVATE, Add_structTask, 0, 0);
+	return OS_OK;
+
+}
+/** OS_enumActivateTasks
+ * @brief Activates several tasks in one kernel entry with a single scheduling decision.
+ *
+ * @param Add_structTasks   Array of the tasks to activate.
+ * @param Copy_u32NoOfTasks Number of tasks in the array.
+ * @return OS_enumErrorStatus Returns OS_OK.
+ *
+ * @details
+ * The function performs the following steps (OS_voidActivateTasksService), through
+ * SVC_ACTIVATE_BATCH from a task or with interrupts masked from an interrupt handler:
+ * 1. Marks every task of the array ready, as `OS_enumActivateTask` does: a delayed or blocked task
+ *    leaves the timeout list and its wait list first. Tasks already ready or running are skipped so
+ *    they are not queued twice.
+ * 2. Reschedules once: at most one context switch, to the highest priority task of the batch if it
+ *    preempts the caller.
+ *
+ * Example usage:
+ * @code
+ * OS_structTask* workers[] = { &w1, &w2, &w3, &w4, &w5, &w6 };
+ * OS_enumActivateTasks(workers, 6);
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumActivateTasks(OS_structTask** Add_structTasks, u32 Copy_u32NoOfTasks){
+	u32 Loc_u32State;
 
-	/* Request activate to SVC  */
-	OS_REQUEST_SERVICE(SVC_ACTIVATE);
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidActivateTasksService(Add_structTasks, Copy_u32NoOfTasks);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_ACTIVATE_BATCH, Add_structTasks, Copy_u32NoOfTasks, 0);
+	}
 	return OS_OK;
+}
+/** OS_voidActivateTasksService
+ * @brief Kernel side of OS_enumActivateTasks, see its steps.
+ */
+void OS_voidActivateTasksService(OS_structTask** Add_structTasks, u32 Copy_u32NoOfTasks){
+	OS_structTask* Loc_structTask;
 
+	for(u32 Loc_u32Index = 0 ; Loc_u32Index < Copy_u32NoOfTasks ; Loc_u32Index++){
+		Loc_structTask = Add_structTasks[Loc_u32Index];
+		if((Loc_structTask->TaskState == OS_TASK_READY) || (Loc_structTask->TaskState == OS_TASK_RUNNING))
+			continue;
+		/* A delayed or blocked task activated early leaves the timeout list and its wait list */
+		OS_voidTimeoutRemove(Loc_structTask);
+		OS_voidWaitListRemove(Loc_structTask);
+		OS_MarkTaskReady(Loc_structTask);
+	}
+	OS_voidSchedule();
 }
 /** OS_enumTerminateTask
  * @brief Terminates a task by changing its state to suspended.
  *
- * This function terminates a task by changing its state from any state to suspended
- * (`OS_TASK_SUSPEND`). It then requests termination of the task via a service call
- * to the operating system.
+ * This function requests termination of the task via a service call to the operating
+ * system, which changes its state from any state to suspended (`OS_TASK_SUSPEND`).
  *
  * @param Add_structTask Pointer to the task structure to terminate.
  * @return OS_enumErrorStatus Returns OS_OK indicating successful task termination.
  *
  * @details
  * The function performs the following steps to terminate a task:
- * 1. Changes the state of the task to suspended (`TaskState = OS_TASK_SUSPEND`).
- * 2. Requests termination of the task by calling `OS_REQUEST_SERVICE(SVC_TERMINATE)`.
+ * 1. Requests termination of the task through `SVC_TERMINATE`.
+ * 2. In the kernel: removes it from its ready queue, the timeout list and its wait list, and
+ *    changes its state to suspended (`TaskState = OS_TASK_SUSPEND`) in the same critical section.
+ * 3. Reschedules (a task terminating itself is switched out at once).
  *
  * Example usage:
  * @code
  * OS_structTask myTask;
  * OS_enumTerminateTask(&myTask);
- * // Terminates 'myTask' by changing its state to suspended and requesting termination via SVC.
+ * // Terminates 'myTask' by requesting termination via SVC.
  * @endcode
  */
 OS_enumErrorStatus OS_enumTerminateTask(OS_structTask* Add_structTask){
-	/* Change State from Suspend to Waiting */
-	Add_structTask->TaskState = OS_TASK_SUSPEND ;
-	/* Request terminate to SVC  */
-	OS_REQUEST_SERVICE(SVC_TERMINATE);
+	/* Request terminate to SVC, the kernel changes the state with the lists */
+	OS_REQUEST_SERVICE_ARGS(SVC_TERMINATE, Add_structTask, 0, 0);
 	return OS_OK;
 }
 /**
- * @brief Delays a task by enabling blocking and setting a tick count.
+ * @brief Delays a task for a number of ticks.
  *
- * This function delays a task by enabling blocking (`OS_TASK_BLOCKING_ENABLE`)
- * and setting the number of ticks (`TicksCount`) for which the task should wait.
- * It then terminates the task via `OS_enumTerminateTask`.
+ * This function removes the task from the ready queues and inserts it in the timeout list, the
+ * same list timed waits on kernel objects use, so the tick handler wakes it without scanning
+ * every task.
  *
  * @param Add_structTask Pointer to the task structure to delay.
- * @param Copy_u32NoOfTicks Number of ticks to delay the task.
+ * @param Copy_u32NoOfTicks Number of ticks to delay the task (0 waits for the next tick).
  * @return OS_enumErrorStatus Returns OS_OK indicating successful task delay.
  *
  * @details
- * The function performs the following steps to delay a task:
- * 1. Sets blocking enable flag for the task (`Blocking = OS_TASK_BLOCKING_ENABLE`).
- * 2. Sets the number of ticks (`TicksCount`) for the task to wait.
- * 3. Terminates the task using `OS_enumTerminateTask`.
+ * The function performs the following steps to delay a task (OS_voidDelayTaskService):
+ * 1. Removes the task from its ready queue and marks it waiting.
+ * 2. Inserts it in the timeout list with `OS_voidTimeoutInsert`, sorted by wake tick.
+ * 3. Reschedules, a task delaying itself is switched out at once.
  *
  * Example usage:
  * @code
  * OS_structTask myTask;
  * OS_enumDelayTask(&myTask, 100);
- * // Delays 'myTask' for 100 ticks by setting blocking and terminating it.
+ * // 'myTask' runs again 100 ticks later.
  * @endcode
  */
 OS_enumErrorStatus OS_enumDelayTask(OS_structTask* Add_structTask,u32 Copy_u32NoOfTicks){
-	Add_structTask->Waiting.Blocking = OS_TASK_BLOCKING_ENABLE;
-	Add_structTask->Waiting.TicksCount = Copy_u32NoOfTicks;
-	OS_enumTerminateTask(Add_structTask);
+	u32 Loc_u32State;
+
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidDelayTaskService(Add_structTask, Copy_u32NoOfTicks);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_DELAY, Add_structTask, Copy_u32NoOfTicks, 0);
+	}
 	return OS_OK;
 }
+/**
+ * @brief Changes the priority of a task at run time.
+ *
+ * The ready queues and bitmaps are indexed by priority, so `Priority` must not be written
+ * directly once the task is created. This function moves the task to the structures of its new
+ * priority and lets the scheduler preempt as needed.
+ *
+ * @param Add_structTask Pointer to the task structure.
+ * @param Copy_u8Priority New priority (below `OS_TASK_PRIORITY_LEVELS`).
+ * @return OS_enumErrorStatus Returns OS_OK, or TASK_CREATION_ERROR if the priority is out of range.
+ *
+ * @details
+ * The function performs the following steps (OS_voidSetPriorityService), through SVC_SET_PRIORITY
+ * from a task or with interrupts masked from an interrupt handler:
+ * 1. Running, waiting or suspended task: only the field changes, the running task is in no ready queue.
+ * 2. Ready task: leaves the ready queue of its old priority in O(1) (clearing the bitmap bits once
+ *    the queue is empty) and is enqueued at the end of the new one.
+ * 3. Task blocked on a kernel object: leaves the wait list in O(1) and is inserted again by its new
+ *    priority (`Waiting.WaitHead`), so it is woken in the right order.
+ * 4. Reschedules: a ready task raised above the running one, or a running task lowered below a
+ *    ready one, is switched at once.
+ *
+ * Example usage:
+ * @code
+ * // Load shedding: demote logging while the control loop is late
+ * OS_enumSetPriority(&logTask, 1);
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumSetPriority(OS_structTask* Add_structTask, u8 Copy_u8Priority){
+	u32 Loc_u32State;
+
+	if(Copy_u8Priority >= OS_TASK_PRIORITY_LEVELS)
+		return TASK_CREATION_ERROR;
+	if(OS_IS_HANDLER_MODE()){
+		OS_ENTER_CRITICAL(Loc_u32State);
+		OS_voidSetPriorityService(Add_structTask, Copy_u8Priority);
+		OS_EXIT_CRITICAL(Loc_u32State);
+	}
+	else{
+		OS_REQUEST_SERVICE_ARGS(SVC_SET_PRIORITY, Add_structTask, Copy_u8Priority, 0);
+	}
+	return OS_OK;
+}
+/** OS_voidSetPriorityService
+ * @brief Kernel side of OS_enumSetPriority, see its steps.
+ */
+void OS_voidSetPriorityService(OS_structTask* Add_structTask, u8 Copy_u8Priority){
+	OS_structTask** Loc_structWaitList = Add_structTask->Waiting.WaitHead;
+
+	if(Add_structTask->Priority == Copy_u8Priority)
+		return;
+	if(Add_structTask->TaskState == OS_TASK_READY){
+		OS_voidReadyQueueRemove(Add_structTask);
+		Add_structTask->Priority = Copy_u8Priority;
+		OS_MarkTaskReady(Add_structTask);
+	}
+	else{
+		Add_structTask->Priority = Copy_u8Priority;
+	}
+	if(Loc_structWaitList){
+		OS_voidWaitListRemove(Add_structTask);
+		OS_voidWaitListInsert(Loc_structWaitList, Add_structTask);
+	}
+	OS_voidSchedule();
+}
+/** OS_voidDelayTaskService
+ * @brief Kernel side of OS_enumDelayTask, see its steps.
+ */
+void OS_voidDelayTaskService(OS_structTask* Add_structTask, u32 Copy_u32NoOfTicks){
+	if(Add_structTask->TaskState == OS_TASK_READY)
+		OS_voidReadyQueueRemove(Add_structTask);
+	Add_structTask->TaskState = OS_TASK_WAITING;
+	OS_voidTimeoutRemove(Add_structTask);
+	OS_voidTimeoutInsert(Add_structTask, Copy_u32NoOfTicks);
+	OS_voidSchedule();
+}
 /**
  * @brief Initializes the operating system.
  *
@@ -179,9 +533,14 @@ OS_enumErrorStatus OS_enumDelayTask(OS_structTask* Add_structTask,u32 Copy_u32No
  * 1. Initializes hardware using `OS_voidHwInit`.
  * 2. Sets the operating system mode to suspended (`OS_SUSPEND`).
  * 3. Creates the main stack using `OS_enumCreateMainStack`.
- * 4. Initializes the ready queue (`Global_structReadyQueue`) with a capacity of 100.
- * 5. Initializes the idle task (`Global_structIdleTask`) with the lowest priority,
+ * 4. Adds the default heap region (`OS_HEAP_SIZE` bytes) using `OS_enumHeapInit`.
+ * 5. Initializes one empty ready queue (`Global_structReadyQueue`) per priority level, tasks are
+ *    linked in it through `Ready.Next` / `Ready.Prev` so it never fills up.
+ * 6. Initializes the idle task (`Global_structIdleTask`) with the lowest priority,
  *    a task name "IDLE", a stack size of 300, and creates it using `OS_enumCreateTask`.
+ * 7. Links the task pool (`OS_TASK_POOL_SIZE` entries) and cuts the stack pool with `OS_enumStackPoolInit`.
+ * 8. Enables the dispatcher interrupt of the basic tasks with `OS_voidBasicTaskInit` (only with
+ *    `OS_BASIC_TASK_ENABLE` set to 1).
  *
  * @return OS_enumErrorStatus Returns OS_OK if initialization is successful, or an error code
  *         indicating specific initialization failure otherwise.
@@ -207,11 +566,13 @@ OS_enumErrorStatus OS_enumInit(){
 	// Assign Main Stack
 	Error += OS_enumCreateMainStack();
 
+	// Add the default heap region
+	Error += OS_enumHeapInit();
+
 	// Create Ready Queue
 	for(uint32_t i = 0; i<OS_TASK_PRIORITY_LEVELS;i++){
-		if(OS_enumFifoInit(&Global_structReadyQueue[i], Global_structReadyQueueFIFO[i], 5)!=FIFO_NO_ERROR){
-			Error+=FIFO_INIT_ERROR;
-		}
+		Global_structReadyQueue[i].Head = NULL;
+		Global_structReadyQueue[i].Tail = NULL;
 	}
 
 	// Idle Task
@@ -221,6 +582,20 @@ OS_enumErrorStatus OS_enumInit(){
 	Global_structIdleTask.StackSize = 300 ;
 	Error += OS_enumCreateTask(&Global_structIdleTask);
 
+	// Task pool and stack pool of OS_enumSpawnTask
+	Global_structTaskPoolFree = NULL;
+	for(u32 i = OS_TASK_POOL_SIZE ; i > 0 ; i--){
+		Global_structTaskPool[i - 1].AllTasks.Next = Global_structTaskPoolFree;
+		Global_structTaskPool[i - 1].AllTasks.Prev = NULL;
+		Global_structTaskPoolFree = &Global_structTaskPool[i - 1];
+	}
+	Error += OS_enumStackPoolInit();
+
+#if OS_BASIC_TASK_ENABLE == 1
+	// Dispatcher of the basic tasks
+	OS_voidBasicTaskInit();
+#endif
+
 	return Error;
 }
 
@@ -232,6 +607,7 @@ OS_enumErrorStatus OS_enumInit(){
  * 2. Sets the current task to the idle task (`Global_structIdleTask`).
  * 3. Activates the idle task using `OS_enumActivateTask`.
  * 4. Starts the system timer using `OS_voidStartTimer`.
+ *    With `OS_MPU_ENABLE`, programs and enables the MPU using `OS_voidMpuInit`.
  * 5. Sets the Process Stack Pointer (PSP) to the idle task's CurrentPSP.
  * 6. Switches to the PSP mode and executes the idle task's function (`func`).
  *
@@ -259,7 +635,12 @@ OS_enumErrorStatus OS_enumStartOS(){
 	OS_enumActivateTask(&Global_structIdleTask);
 	// 4- Start Timer
 	OS_voidStartTimer();
-	// 5- Set PSP to the IDLE Task
+#if OS_MPU_ENABLE == 1
+	// Shared regions and regions of the IDLE task
+	OS_voidMpuInit();
+#endif
+	// 5- Set PSP (and its limit) to the IDLE Task
+	OS_SET_PSP_LIMIT(OS_StructOS.CurrentTask);
 	OS_SET_PSP(OS_StructOS.CurrentTask->CurrentPSP);
 	OS_SWITCH_TO_PSP();
 	OS_SWITCH_TO_NOT_PRIVELEGE();
@@ -0,0 +1,75 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "Barrier.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//#define NO_OF_STAGES    3
+//
+//OS_tstructBarrier frameEnd;
+//OS_structTask stages[NO_OF_STAGES];
+//volatile u32 Global_u32Frame,Global_u32StageFrame[NO_OF_STAGES],Global_u32Errors,Global_u32Timeouts;
+//
+///* Stages: each works on the current frame for a different time, then meets the others.
+// * The last stage to arrive moves to the next frame, before any stage runs again. */
+//void stageTask(){
+//	u32 id = OS_StructOS.CurrentTask - stages;
+//	while(1){
+//		Global_u32StageFrame[id] = Global_u32Frame;
+//		OS_enumDelayTask(OS_StructOS.CurrentTask, id + 1);
+//		switch(OS_enumBarrierWait(&frameEnd, 50)){
+//			case OS_BARRIER_SERIAL:
+//				for(u32 i = 0 ; i < NO_OF_STAGES ; i++)
+//					if(Global_u32StageFrame[i] != Global_u32Frame)
+//						Global_u32Errors++;
+//				Global_u32Frame++;
+//			break;
+//			case OS_BARRIER_TIMEOUT:
+//				Global_u32Timeouts++;
+//			break;
+//			default:
+//			break;
+//		}
+//	}
+//}
+//
+///* Testing a barrier between three pipeline stages
+// * Expected Output: Global_u32Frame increases every 3 ticks (slowest stage), the stages always
+// *                  work on the same frame: Global_u32Errors and Global_u32Timeouts stay 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumInitBarrier(&frameEnd, NO_OF_STAGES);
+//
+//	for(u32 i = 0 ; i < NO_OF_STAGES ; i++){
+//		stages[i].func = stageTask;
+//		stages[i].Priority = 1 + i ;
+//		strcpy(stages[i].TaskName,"Stage");
+//		stages[i].StackSize = 256;
+//		loc_enumERROR += OS_enumCreateTask(&stages[i]);
+//	}
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	for(u32 i = 0 ; i < NO_OF_STAGES ; i++)
+//		OS_enumActivateTask(&stages[i]);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
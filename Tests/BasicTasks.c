@@ -0,0 +1,98 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "BasicTask.h"
+//#include "Porting_CortexM.h"
+//
+//#define USE_DWT   1   // 0 under qemu-system-arm, it does not emulate the DWT cycle counter
+//
+//OS_structTask tExtended;
+//OS_tstructBasicTask bLow,bHigh;
+//volatile u32 Global_u32Start,Global_u32Worst,Global_u32Best = 0xFFFFFFFF;
+//volatile u32 Global_u32LowRuns,Global_u32HighRuns,Global_u32OrderErrors;
+//
+///* High priority basic task: measures the latency from the activation call to its start */
+//void basicHigh (){
+//#if USE_DWT == 1
+//	u32 cycles = DWT->CYCCNT - Global_u32Start;
+//	if(cycles > Global_u32Worst)
+//		Global_u32Worst = cycles;
+//	if(cycles < Global_u32Best)
+//		Global_u32Best = cycles;
+//#endif
+//	Global_u32HighRuns++;
+//}
+///* Low priority basic task: activates bHigh, which runs nested before the next line */
+//void basicLow (){
+//	u32 runs = Global_u32HighRuns;
+//#if USE_DWT == 1
+//	Global_u32Start = DWT->CYCCNT;
+//#endif
+//	OS_enumBasicTaskActivate(&bHigh);
+//	if(Global_u32HighRuns != runs + 1)
+//		Global_u32OrderErrors++;
+//	Global_u32LowRuns++;
+//}
+///* Extended task: activates bLow in a loop, each call preempts it at once (no SVC, no PSP switch) */
+//void taskExtended (){
+//	while(1){
+//		OS_enumBasicTaskActivate(&bLow);
+//		OS_enumDelayTask(&tExtended, 1);
+//	}
+//}
+///* Interrupts activate basic tasks too (e.g. a button), they start after the handler returns */
+//void EXTI0_IRQHandler (){
+//	OS_enumBasicTaskActivate(&bLow);
+//}
+//
+///* Testing OS for basic tasks (run-to-completion tasks on the main stack), OS_BASIC_TASK_ENABLE set to 1
+// * Expected Output: Global_u32OrderErrors stays 0, Global_u32LowRuns == Global_u32HighRuns and
+// *                  Global_u32Best / Global_u32Worst give the cycles of a nested activation,
+// *                  compare with Global_u32SwitchBest of ContextSwitchBenchmark.c */
+//int main(){
+//
+//#if USE_DWT == 1
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//#endif
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	// Basic tasks need no stack, only a priority
+//	bLow.func = basicLow;
+//	bLow.Priority = 1 ;
+//	strcpy(bLow.TaskName,"Basic Low");
+//
+//	bHigh.func = basicHigh;
+//	bHigh.Priority = 2 ;
+//	strcpy(bHigh.TaskName,"Basic High");
+//
+//	loc_enumERROR = OS_enumBasicTaskCreate(&bLow);
+//	loc_enumERROR += OS_enumBasicTaskCreate(&bHigh);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	tExtended.func = taskExtended;
+//	tExtended.Priority = 1 ;
+//	strcpy(tExtended.TaskName,"Extended");
+//	tExtended.StackSize = 512;
+//
+//	loc_enumERROR = OS_enumCreateTask(&tExtended);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&tExtended);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
@@ -0,0 +1,109 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "Semaphore.h"
+//#include "CondVar.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//#define NO_OF_BUFFERS   4
+//
+//OS_tstructSemaphore bufferLock;
+//OS_tstructCondVar bufferFreed,bufferFilled;
+//OS_structTask producer,consumer1,consumer2;
+//volatile u32 Global_u32Free = NO_OF_BUFFERS,Global_u32Filled;
+//volatile u32 Global_u32Produced,Global_u32Consumed[2],Global_u32Timeouts,Global_u32Errors;
+//
+///* Producer: fills a buffer every 2 ticks, waits (no polling) while none is free */
+//void producerTask(){
+//	while(1){
+//		OS_enumAcquireSemaphore(&bufferLock, OS_WAIT_FOREVER);
+//		while(Global_u32Free == 0)
+//			OS_enumCondWait(&bufferFreed, &bufferLock, OS_WAIT_FOREVER);
+//		Global_u32Free--;
+//		Global_u32Filled++;
+//		Global_u32Produced++;
+//		OS_enumCondBroadcast(&bufferFilled); // Consumers are queued on bufferLock, not woken
+//		OS_enumReleaseSemaphore(&bufferLock);
+//		OS_enumDelayTask(&producer, 2);
+//	}
+//}
+//
+///* Consumers: wait for a filled buffer at most 100 ticks */
+//void consumerTask(){
+//	u32 id = (OS_StructOS.CurrentTask == &consumer2);
+//	OS_tenuCondVarState Loc_enumState;
+//	while(1){
+//		OS_enumAcquireSemaphore(&bufferLock, OS_WAIT_FOREVER);
+//		while(Global_u32Filled == 0){
+//			Loc_enumState = OS_enumCondWait(&bufferFilled, &bufferLock, 100);
+//			if(Loc_enumState == OS_CONDVAR_TIMEOUT)
+//				Global_u32Timeouts++;
+//			else if(Loc_enumState == OS_CONDVAR_MUTEX_LOST){ // Not expected here, take the lock back
+//				Global_u32Errors++;
+//				OS_enumAcquireSemaphore(&bufferLock, OS_WAIT_FOREVER);
+//			}
+//		}
+//		if(bufferLock.currentOwner != OS_StructOS.CurrentTask)
+//			Global_u32Errors++;
+//		Global_u32Filled--;
+//		Global_u32Free++;
+//		Global_u32Consumed[id]++;
+//		OS_enumCondSignal(&bufferFreed);
+//		OS_enumReleaseSemaphore(&bufferLock);
+//	}
+//}
+//
+///* Testing condition variables with a producer and two consumers sharing 4 buffers
+// * Expected Output: Global_u32Consumed[0] + Global_u32Consumed[1] follows Global_u32Produced,
+// *                  consumer2 (higher priority) consumes most buffers, Global_u32Errors stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumInitSemaphore(&bufferLock, 1);
+//	OS_enumInitCondVar(&bufferFreed);
+//	OS_enumInitCondVar(&bufferFilled);
+//
+//	producer.func = producerTask;
+//	producer.Priority = 1 ;
+//	strcpy(producer.TaskName,"Producer");
+//	producer.StackSize = 256;
+//
+//	consumer1.func = consumerTask;
+//	consumer1.Priority = 2 ;
+//	strcpy(consumer1.TaskName,"Consumer 1");
+//	consumer1.StackSize = 256;
+//
+//	consumer2.func = consumerTask;
+//	consumer2.Priority = 3 ;
+//	strcpy(consumer2.TaskName,"Consumer 2");
+//	consumer2.StackSize = 256;
+//
+//	loc_enumERROR = OS_enumCreateTask(&producer);
+//	loc_enumERROR += OS_enumCreateTask(&consumer1);
+//	loc_enumERROR += OS_enumCreateTask(&consumer2);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&producer);
+//	OS_enumActivateTask(&consumer1);
+//	OS_enumActivateTask(&consumer2);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
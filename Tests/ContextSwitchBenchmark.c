@@ -0,0 +1,81 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "Porting_CortexM.h"
+//
+//#define USE_DWT   1   // 0 under qemu-system-arm, it does not emulate the DWT cycle counter
+//
+//OS_structTask tLow,tHigh;
+//volatile u32 Global_u32Start,Global_u32Switches;
+//volatile u32 Global_u32SwitchWorst,Global_u32SwitchBest = 0xFFFFFFFF;
+//
+///* Runs once per activation by tLow, measures activation SVC + PendSV switch */
+//void taskHigh (){
+//	while(1){
+//#if USE_DWT == 1
+//		u32 cycles = DWT->CYCCNT - Global_u32Start;
+//		if(cycles > Global_u32SwitchWorst)
+//			Global_u32SwitchWorst = cycles;
+//		if(cycles < Global_u32SwitchBest)
+//			Global_u32SwitchBest = cycles;
+//#endif
+//		Global_u32Switches++;
+//		OS_enumTerminateTask(&tHigh);
+//	}
+//}
+//void taskLow (){
+//	while(1){
+//#if USE_DWT == 1
+//		Global_u32Start = DWT->CYCCNT;
+//#endif
+//		OS_enumActivateTask(&tHigh);
+//	}
+//}
+//
+///* Benchmarking the context switch
+// * tLow activates tHigh in a loop, tHigh terminates itself at once: two switches per loop.
+// * Build once with OS_PORT_CORTEX_M3 (STM32F103 or qemu -M lm3s6965evb) and once with
+// * OS_PORT_CORTEX_M33 (qemu -M mps2-an505) to compare the ports: PSPLIM costs two instructions,
+// * OS_STACK_CHECK and OS_MPU_ENABLE add theirs on Cortex-M3.
+// * Expected Output: Global_u32SwitchBest close to Global_u32SwitchWorst (cycles from the
+// *                  activation request to tHigh running), Global_u32Switches read after a known
+// *                  number of ticks gives the switch rate without DWT */
+//int main(){
+//
+//#if USE_DWT == 1
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//#endif
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	tLow.func = taskLow;
+//	tLow.Priority = 1 ;
+//	strcpy(tLow.TaskName,"Low");
+//	tLow.StackSize = 512;
+//
+//	tHigh.func = taskHigh;
+//	tHigh.Priority = 2 ;
+//	strcpy(tHigh.TaskName,"High");
+//	tHigh.StackSize = 512;
+//
+//	loc_enumERROR = OS_enumCreateTask(&tLow);
+//	loc_enumERROR += OS_enumCreateTask(&tHigh);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&tLow);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
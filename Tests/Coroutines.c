@@ -0,0 +1,88 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "Coroutine.h"
+//
+//#define NO_OF_SESSIONS   60
+//
+///* One protocol session: the coroutine is the first member, the rest is its state (no stack) */
+//typedef struct{
+//	OS_tstructCoroutine co;
+//	OS_tstructCoroutineSignal rx;
+//	u32 frames;
+//}Session;
+//
+//OS_structTask tHost,tProducer;
+//OS_tstructCoroutineHost sessionsHost;
+//Session sessions[NO_OF_SESSIONS];
+//
+///* Session state machine: waits for a frame, answers after a turnaround delay */
+//OS_tenuCoroutineStatus sessionCo(OS_tstructCoroutine* co){
+//	Session* s = (Session*)co;
+//	OS_CO_BEGIN(co);
+//	while(1){
+//		OS_CO_WAIT_SIGNAL(co, &s->rx);
+//		s->frames++;
+//		OS_CO_DELAY(co, 2);             // Turnaround time before the answer
+//		OS_CO_YIELD(co);
+//	}
+//	OS_CO_END(co);
+//}
+//void taskHost (){
+//	OS_voidCoroutineRun(&sessionsHost);
+//}
+///* Stands for the receive interrupt: one frame for every session in turn */
+//void taskProducer (){
+//	u32 i = 0;
+//	while(1){
+//		OS_voidCoroutineSignal(&sessions[i].rx);
+//		i = (i + 1) % NO_OF_SESSIONS;
+//		OS_enumDelayTask(&tProducer, 1);
+//	}
+//}
+//
+///* Testing OS for coroutines: 60 sessions on one task with a 512 bytes stack
+// * (60 * 48 bytes of session state instead of 60 task structures and stacks).
+// * Expected Output: sessions[i].frames grow evenly, one frame per session every 60 ticks */
+//int main(){
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_voidCoroutineHostInit(&sessionsHost);
+//	for(u32 i = 0 ; i < NO_OF_SESSIONS ; i++){
+//		sessions[i].co.func = sessionCo;
+//		OS_voidCoroutineSignalInit(&sessions[i].rx);
+//		loc_enumERROR += OS_enumCoroutineStart(&sessionsHost, &sessions[i].co);
+//	}
+//
+//	tHost.func = taskHost;
+//	tHost.Priority = 2 ;
+//	strcpy(tHost.TaskName,"Sessions");
+//	tHost.StackSize = 512;
+//
+//	tProducer.func = taskProducer;
+//	tProducer.Priority = 3 ;
+//	strcpy(tProducer.TaskName,"Producer");
+//	tProducer.StackSize = 256;
+//
+//	loc_enumERROR += OS_enumCreateTask(&tHost);
+//	loc_enumERROR += OS_enumCreateTask(&tProducer);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&tHost);
+//	OS_enumActivateTask(&tProducer);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
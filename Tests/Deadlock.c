@@ -15,9 +15,9 @@
 //		Global_u8Task1Led ^= 1;
 //		count++;
 //		if(count == 100){
-//			OS_enumAcquireSemaphore(&s1, &t1);
+//			OS_enumAcquireSemaphore(&s1, OS_WAIT_FOREVER);
 //			OS_enumActivateTask(&t2);
-//			OS_enumAcquireSemaphore(&s2, &t1);
+//			OS_enumAcquireSemaphore(&s2, OS_WAIT_FOREVER);
 //		}
 //		if(count == 300){
 //			count = 0;
@@ -32,8 +32,8 @@
 //		Global_u8Task2Led ^= 1;
 //		count++;
 //		if(count == 200){
-//			OS_enumAcquireSemaphore(&s2, &t2);
-//			OS_enumAcquireSemaphore(&s1, &t2);
+//			OS_enumAcquireSemaphore(&s2, OS_WAIT_FOREVER);
+//			OS_enumAcquireSemaphore(&s1, OS_WAIT_FOREVER);
 //		}
 //		if(count == 300){
 //			OS_enumTerminateTask(&t2);
@@ -0,0 +1,101 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "PingPong.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//#define SAMPLES_PER_BLOCK   256
+//
+//OS_tstructPingPong adc1;
+//u16 adc1Samples[2][SAMPLES_PER_BLOCK];
+//OS_structTask t1,t2;
+//u8 Global_u8Task1Led;
+//volatile u32 Global_u32Blocks,Global_u32BlocksPerSecond,Global_u32Overruns,Global_u32Average;
+//
+///* ADC1 runs continuous conversions and DMA1 channel 1 writes adc1Samples in circular mode,
+// * the half transfer interrupt hands over adc1Samples[0] and the complete one adc1Samples[1] */
+//void DMA1_Channel1_IRQHandler(void){
+//	DMA1->IFCR = DMA_IFCR_CHTIF1 | DMA_IFCR_CTCIF1;
+//	OS_voidPingPongBufferFilledFromISR(&adc1);
+//}
+//void task1 (){
+//	u16* block;
+//	u32 sum;
+//	while(1){
+//		Global_u8Task1Led ^= 1;
+//		// The samples are read where the DMA wrote them, no copy
+//		if(OS_enumPingPongBorrow(&adc1, (void**)&block, OS_WAIT_FOREVER) == OS_PINGPONG_EMPTY)
+//			continue;
+//		sum = 0;
+//		for(u32 i = 0 ; i < SAMPLES_PER_BLOCK ; i++)
+//			sum += block[i];
+//		if(OS_enumPingPongRelease(&adc1) == OS_PINGPONG_OK)
+//			Global_u32Average = sum / SAMPLES_PER_BLOCK;
+//		Global_u32Blocks++;
+//	}
+//}
+//void task2 (){
+//	u32 last = 0;
+//	while(1){
+//		OS_enumDelayTask(&t2, 1000);
+//		Global_u32BlocksPerSecond = Global_u32Blocks - last;
+//		Global_u32Overruns = adc1.OverrunCount;
+//		last = Global_u32Blocks;
+//	}
+//}
+//
+///* Testing OS for DMA to task handoff
+// * At 200 kS/s a block of 256 samples is handed over every 1.28 ms, T1 (highest priority)
+// * is made ready by the DMA interrupt and processes the block in place.
+// * T2 samples the counters every 1000 ticks.
+// * Expected Output: Global_u32BlocksPerSecond about 781, Global_u32Overruns stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//	// ADC1 + DMA1 channel 1 (circular, 16 bits, half/complete interrupts) configured here
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	if(OS_enumPingPongCreate(&adc1, (u8*)adc1Samples, sizeof(adc1Samples[0]), 2) != OS_PINGPONG_INIT_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 5 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t2.func = task2;
+//	t2.Priority = 2 ;
+//	strcpy(t2.TaskName,"Task 2");
+//	t2.StackSize = 512;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t2);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	loc_enumERROR= OS_enumActivateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//	loc_enumERROR= OS_enumActivateTask(&t2);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
@@ -0,0 +1,115 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "FIFO.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//#define TOTAL_ELEMENTS   1024
+//#define CHUNK_ELEMENTS   16
+//#define FIFO_LENGTH      64
+//
+///* Previous FIFO (V01) baseline: word elements only, pointers wrapped by comparing with the
+// * last slot and a separate counter, enqueue/dequeue are functions in FIFO.c (never inlined) */
+//typedef struct{
+//	u32  counter;
+//	u32* head;
+//	u32* tail;
+//	u32* base;
+//	u32  length;
+//}V1_tBuffer;
+//__attribute__((noinline)) OS_enumBufferStatus v1_enqueue(V1_tBuffer* fifo, u32 item){
+//	if(!fifo->base || !fifo->length)
+//		return FIFO_NULL;
+//	if((fifo->head == fifo->tail) && (fifo->counter == fifo->length))
+//		return FIFO_FULL;
+//	*(fifo->tail) = item;
+//	fifo->counter++;
+//	if(fifo->tail == fifo->base + fifo->length - 1)
+//		fifo->tail = fifo->base;
+//	else
+//		fifo->tail++;
+//	return FIFO_NO_ERROR;
+//}
+//__attribute__((noinline)) OS_enumBufferStatus v1_dequeue(V1_tBuffer* fifo, u32* item){
+//	if(!fifo->base || !fifo->length)
+//		return FIFO_NULL;
+//	if(fifo->head == fifo->tail)
+//		return FIFO_EMPTY;
+//	*item = *(fifo->head);
+//	fifo->counter--;
+//	if(fifo->head == fifo->base + fifo->length - 1)
+//		fifo->head = fifo->base;
+//	else
+//		fifo->head++;
+//	return FIFO_NO_ERROR;
+//}
+//
+//V1_tBuffer v1;
+//u32 v1Buffer[FIFO_LENGTH];
+//OS_tBuffer f1;
+//u32 f1Buffer[FIFO_LENGTH];
+//u32 Global_u32Source[CHUNK_ELEMENTS],Global_u32Destination[CHUNK_ELEMENTS];
+//volatile u32 Global_u32CyclesPrevious,Global_u32CyclesPerElement,Global_u32CyclesBatch,Global_u32Errors;
+//
+///* Testing FIFO throughput
+// * The same 1024 words (the element the previous FIFO was limited to) go through a 64 slots
+// * FIFO in chunks of 16: once with the previous enqueue/dequeue, once with OS_enumFifoEnqueue/
+// * OS_enumFifoDequeue per element and once with OS_u32FifoPushN/OS_u32FifoPopN.
+// * Cycles are counted by the DWT cycle counter, no task is needed.
+// * Expected Output: Global_u32CyclesPerElement lower than Global_u32CyclesPrevious, Global_u32CyclesBatch
+// *                  much lower than both, Global_u32Errors stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//
+//	v1.base = v1.head = v1.tail = v1Buffer;
+//	v1.length = FIFO_LENGTH;
+//	v1.counter = 0;
+//	if(OS_FIFO_INIT(&f1, f1Buffer) != FIFO_NO_ERROR)
+//		while(1);
+//
+//	for(u32 i = 0 ; i < CHUNK_ELEMENTS ; i++)
+//		Global_u32Source[i] = 0x1000 + i;
+//
+//	u32 start = DWT->CYCCNT;
+//	for(u32 n = 0 ; n < TOTAL_ELEMENTS ; n += CHUNK_ELEMENTS){
+//		for(u32 i = 0 ; i < CHUNK_ELEMENTS ; i++)
+//			v1_enqueue(&v1, Global_u32Source[i]);
+//		for(u32 i = 0 ; i < CHUNK_ELEMENTS ; i++)
+//			v1_dequeue(&v1, &Global_u32Destination[i]);
+//	}
+//	Global_u32CyclesPrevious = DWT->CYCCNT - start;
+//	if(memcmp(Global_u32Source, Global_u32Destination, sizeof(Global_u32Source)))
+//		Global_u32Errors++;
+//
+//	memset(Global_u32Destination, 0, sizeof(Global_u32Destination));
+//	start = DWT->CYCCNT;
+//	for(u32 n = 0 ; n < TOTAL_ELEMENTS ; n += CHUNK_ELEMENTS){
+//		for(u32 i = 0 ; i < CHUNK_ELEMENTS ; i++)
+//			OS_enumFifoEnqueue(&f1, &Global_u32Source[i]);
+//		for(u32 i = 0 ; i < CHUNK_ELEMENTS ; i++)
+//			OS_enumFifoDequeue(&f1, &Global_u32Destination[i]);
+//	}
+//	Global_u32CyclesPerElement = DWT->CYCCNT - start;
+//	if(memcmp(Global_u32Source, Global_u32Destination, sizeof(Global_u32Source)))
+//		Global_u32Errors++;
+//
+//	memset(Global_u32Destination, 0, sizeof(Global_u32Destination));
+//	start = DWT->CYCCNT;
+//	for(u32 n = 0 ; n < TOTAL_ELEMENTS ; n += CHUNK_ELEMENTS){
+//		OS_u32FifoPushN(&f1, Global_u32Source, CHUNK_ELEMENTS);
+//		OS_u32FifoPopN(&f1, Global_u32Destination, CHUNK_ELEMENTS);
+//	}
+//	Global_u32CyclesBatch = DWT->CYCCNT - start;
+//	if(memcmp(Global_u32Source, Global_u32Destination, sizeof(Global_u32Source)))
+//		Global_u32Errors++;
+//
+//	while(1);
+//
+//
+//}
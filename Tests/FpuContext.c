@@ -0,0 +1,84 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//
+//OS_structTask t1,t2,t3;
+//volatile u32 Global_u32Task1Errors,Global_u32Task2Errors,Global_u32Task3Loops;
+//
+///* DSP tasks: long float computations, preempted in the middle by the tick and by each other.
+// * Any S register corrupted by a switch breaks the running check. */
+//void task1 (){
+//	while(1){
+//		float acc = 0.0f;
+//		for(u32 i = 1 ; i <= 1000 ; i++)
+//			acc += 0.5f;
+//		if(acc != 500.0f)
+//			Global_u32Task1Errors++;
+//	}
+//}
+//void task2 (){
+//	while(1){
+//		float acc = 1.0f;
+//		for(u32 i = 0 ; i < 20 ; i++)
+//			acc *= 2.0f;
+//		if(acc != 1048576.0f)
+//			Global_u32Task2Errors++;
+//		OS_enumDelayTask(&t2, 1);
+//	}
+//}
+///* Integer only task: never touches the FPU, switched with the 9 words integer frame */
+//void task3 (){
+//	while(1){
+//		Global_u32Task3Loops++;
+//		OS_enumDelayTask(&t3, 2);
+//	}
+//}
+//
+///* Testing OS for FPU context switching (OS_PORT = OS_PORT_CORTEX_M4F, built with
+// * -mfpu=fpv4-sp-d16 -mfloat-abi=hard), e.g. under qemu-system-arm -M netduinoplus2 or mps2-an386.
+// * T1 and T2 share priority 3 (round robin on every tick), T3 preempts both.
+// * Expected Output: Global_u32Task1Errors and Global_u32Task2Errors stay 0, Global_u32Task3Loops grows.
+// *                  With the Cortex-M3 PendSV (no S16-S31 save) the error counters grow. */
+//int main(){
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	// FPU tasks need 26 + 17 more words than integer ones (frame + S16-S31 + EXC_RETURN)
+//	t1.func = task1;
+//	t1.Priority = 3 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	t2.func = task2;
+//	t2.Priority = 3 ;
+//	strcpy(t2.TaskName,"Task 2");
+//	t2.StackSize = 1024;
+//
+//	t3.func = task3;
+//	t3.Priority = 4 ;
+//	strcpy(t3.TaskName,"Task 3");
+//	t3.StackSize = 256;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	loc_enumERROR += OS_enumCreateTask(&t2);
+//	loc_enumERROR += OS_enumCreateTask(&t3);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&t1);
+//	OS_enumActivateTask(&t2);
+//	OS_enumActivateTask(&t3);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
@@ -0,0 +1,137 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Mem_Management.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//#define OPERATIONS    20000
+//#define SLOTS         32
+//#define MAX_BYTES     256
+//#define FF_HEAP_SIZE  4096
+//
+///* First-fit baseline: one free list in address order, allocation walks it until a block fits */
+//typedef struct FF_Block{
+//	u32 size;                 // Payload bytes
+//	struct FF_Block* next;    // Next free block (address order)
+//}FF_Block;
+//u32 ffHeap[FF_HEAP_SIZE / 4];
+//FF_Block* ffFree;
+//void ff_init(void){
+//	ffFree = (FF_Block*)ffHeap;
+//	ffFree->size = FF_HEAP_SIZE - sizeof(FF_Block);
+//	ffFree->next = NULL;
+//}
+//void* ff_malloc(u32 size){
+//	FF_Block **link = &ffFree, *b;
+//	size = (size + 7) & ~7;
+//	for(b = ffFree ; b ; link = &b->next, b = b->next){
+//		if(b->size < size)
+//			continue;
+//		if(b->size >= size + sizeof(FF_Block) + 8){
+//			FF_Block* rest = (FF_Block*)((u8*)(b + 1) + size);
+//			rest->size = b->size - size - sizeof(FF_Block);
+//			rest->next = b->next;
+//			b->size = size;
+//			*link = rest;
+//		}
+//		else
+//			*link = b->next;
+//		return b + 1;
+//	}
+//	return NULL;
+//}
+//void ff_free(void* p){
+//	FF_Block *b = (FF_Block*)p - 1, *prev = NULL, *cur = ffFree;
+//	while(cur && cur < b){ prev = cur; cur = cur->next; }
+//	b->next = cur;
+//	if(cur && (u8*)(b + 1) + b->size == (u8*)cur){ b->size += sizeof(FF_Block) + cur->size; b->next = cur->next; }
+//	if(prev){
+//		prev->next = b;
+//		if((u8*)(prev + 1) + prev->size == (u8*)b){ prev->size += sizeof(FF_Block) + b->size; prev->next = b->next; }
+//	}
+//	else
+//		ffFree = b;
+//}
+//
+//void* Global_pvSlots[SLOTS];
+//volatile u32 Global_u32TlsfWorst,Global_u32TlsfAverage,Global_u32FirstFitWorst,Global_u32FirstFitAverage;
+//volatile u32 Global_u32TlsfFailures,Global_u32FirstFitFailures,Global_u32Fragmentation;
+//OS_tstructHeapStats Global_structStats;
+//
+///* Same pseudo random trace for both allocators */
+//static u32 seed;
+//static u32 next_random(void){
+//	seed = seed * 1664525 + 1013904223;
+//	return seed >> 8;
+//}
+//
+///* Benchmarking the TLSF heap against a first-fit allocator
+// * Both heaps get 4 KB and replay the same random trace of 20000 operations: a random slot
+// * is freed if used, else filled with 1..256 bytes. Only allocations are timed by the DWT
+// * cycle counter. The TLSF service is called directly, OS_pvMalloc only adds the SVC entry.
+// * Expected Output: Global_u32TlsfWorst stays close to Global_u32TlsfAverage while
+// *                  Global_u32FirstFitWorst grows with the length of its free list */
+//int main(){
+//	u32 start,cycles,total,allocations;
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//
+//	// OS_HEAP_SIZE must be 4096 for a fair comparison
+//	if(OS_enumHeapInit() != OS_OK)
+//		while(1);
+//
+//	seed = 1; total = 0; allocations = 0;
+//	for(u32 n = 0 ; n < OPERATIONS ; n++){
+//		u32 r = next_random();
+//		u32 slot = r % SLOTS;
+//		if(Global_pvSlots[slot]){
+//			OS_voidHeapFreeService(Global_pvSlots[slot]);
+//			Global_pvSlots[slot] = NULL;
+//			continue;
+//		}
+//		start = DWT->CYCCNT;
+//		Global_pvSlots[slot] = OS_pvHeapAllocService(1 + (r >> 5) % MAX_BYTES);
+//		cycles = DWT->CYCCNT - start;
+//		total += cycles; allocations++;
+//		if(cycles > Global_u32TlsfWorst)
+//			Global_u32TlsfWorst = cycles;
+//		if(!Global_pvSlots[slot])
+//			Global_u32TlsfFailures++;
+//	}
+//	Global_u32TlsfAverage = total / allocations;
+//	OS_voidHeapStatsService(&Global_structStats);
+//	Global_u32Fragmentation = Global_structStats.FragmentationPercent;
+//	for(u32 i = 0 ; i < SLOTS ; i++)
+//		OS_voidHeapFreeService(Global_pvSlots[i]);
+//
+//	memset(Global_pvSlots, 0, sizeof(Global_pvSlots));
+//	ff_init();
+//	seed = 1; total = 0; allocations = 0;
+//	for(u32 n = 0 ; n < OPERATIONS ; n++){
+//		u32 r = next_random();
+//		u32 slot = r % SLOTS;
+//		if(Global_pvSlots[slot]){
+//			ff_free(Global_pvSlots[slot]);
+//			Global_pvSlots[slot] = NULL;
+//			continue;
+//		}
+//		start = DWT->CYCCNT;
+//		Global_pvSlots[slot] = ff_malloc(1 + (r >> 5) % MAX_BYTES);
+//		cycles = DWT->CYCCNT - start;
+//		total += cycles; allocations++;
+//		if(cycles > Global_u32FirstFitWorst)
+//			Global_u32FirstFitWorst = cycles;
+//		if(!Global_pvSlots[slot])
+//			Global_u32FirstFitFailures++;
+//	}
+//	Global_u32FirstFitAverage = total / allocations;
+//
+//	while(1);
+//
+//
+//}
@@ -0,0 +1,112 @@
+//#include <string.h>
+//#include <stdlib.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "MemPool.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//#define ROUNDS        1000
+//#define BLOCK_BYTES   32
+//#define LIVE_BLOCKS   8
+//
+//OS_tstructPool p1;
+//OS_POOL_MEMORY(p1Memory, BLOCK_BYTES, LIVE_BLOCKS);
+//OS_structTask t1;
+//void* Global_pvLive[LIVE_BLOCKS];
+//volatile u32 Global_u32PoolWorst,Global_u32PoolAverage,Global_u32MallocWorst,Global_u32MallocAverage;
+//volatile u32 Global_u32HighWaterMark,Global_u32Errors,Global_u32Done;
+//
+///* Measures one alloc + free pair per round, the live set keeps the heap fragmented */
+//void task1 (){
+//	u32 start,cycles,total;
+//	while(1){
+//		total = 0;
+//		for(u32 n = 0 ; n < ROUNDS ; n++){
+//			u32 slot = n % LIVE_BLOCKS;
+//			start = DWT->CYCCNT;
+//			if(Global_pvLive[slot])
+//				OS_enumPoolFree(&p1, Global_pvLive[slot]);
+//			if(OS_enumPoolAlloc(&p1, &Global_pvLive[slot], 0) != OS_POOL_OK)
+//				Global_u32Errors++;
+//			cycles = DWT->CYCCNT - start;
+//			total += cycles;
+//			if(cycles > Global_u32PoolWorst)
+//				Global_u32PoolWorst = cycles;
+//		}
+//		Global_u32PoolAverage = total / ROUNDS;
+//		Global_u32HighWaterMark = OS_u32PoolHighWaterMark(&p1);
+//
+//		memset(Global_pvLive, 0, sizeof(Global_pvLive));
+//		total = 0;
+//		for(u32 n = 0 ; n < ROUNDS ; n++){
+//			u32 slot = n % LIVE_BLOCKS;
+//			start = DWT->CYCCNT;
+//			free(Global_pvLive[slot]);
+//			// Varying sizes like real messages, the pool doesn't care about them
+//			Global_pvLive[slot] = malloc(BLOCK_BYTES - (n & 7) * 4);
+//			cycles = DWT->CYCCNT - start;
+//			total += cycles;
+//			if(cycles > Global_u32MallocWorst)
+//				Global_u32MallocWorst = cycles;
+//			if(!Global_pvLive[slot])
+//				Global_u32Errors++;
+//		}
+//		Global_u32MallocAverage = total / ROUNDS;
+//		for(u32 i = 0 ; i < LIVE_BLOCKS ; i++)
+//			free(Global_pvLive[i]);
+//		memset(Global_pvLive, 0, sizeof(Global_pvLive));
+//
+//		// Pool blocks are reused from here on
+//		Global_u32PoolWorst = 0;
+//		Global_u32Done++;
+//		OS_enumDelayTask(&t1, 1000);
+//		for(u32 i = 0 ; i < LIVE_BLOCKS ; i++)
+//			Global_pvLive[i] = NULL;
+//		OS_enumPoolCreate(&p1, p1Memory, BLOCK_BYTES, LIVE_BLOCKS);
+//	}
+//}
+//
+///* Benchmarking the fixed-block pool against newlib malloc/free
+// * Cycles are counted by the DWT cycle counter around each alloc + free pair, the pool path
+// * includes the SVC entry since tasks are unprivileged.
+// * Expected Output: Global_u32PoolWorst close to Global_u32PoolAverage (constant time),
+// *                  Global_u32MallocWorst well above Global_u32MallocAverage, Global_u32Errors stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	if(OS_enumPoolCreate(&p1, p1Memory, BLOCK_BYTES, LIVE_BLOCKS) != OS_POOL_INIT_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 3 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	loc_enumERROR= OS_enumActivateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
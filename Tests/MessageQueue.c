@@ -0,0 +1,112 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "Queue.h"
+//
+//#include "RCC_interface.h"
+//
+//typedef struct{
+//	u32 sequence;
+//	u16 channel;
+//	u16 value;
+//}Telemetry_t;
+//
+//OS_tstructQueue q1;
+//Telemetry_t q1Buffer[8];
+//OS_structTask t1,t2,t3;
+//u8 Global_u8Task1Led,Global_u8Task2Led;
+//volatile u32 Global_u32Received,Global_u32MessagesPerSecond,Global_u32Errors;
+//void task1 (){
+//	Telemetry_t msg = {0,1,0};
+//	while(1){
+//		Global_u8Task1Led ^= 1;
+//		msg.sequence++;
+//		msg.value ^= 0xFFFF;
+//		OS_enumQueueSend(&q1, &msg, OS_WAIT_FOREVER);
+//	}
+//}
+//void task2 (){
+//	Telemetry_t msg;
+//	u32 expected = 1;
+//	while(1){
+//		Global_u8Task2Led ^= 1;
+//		if(OS_enumQueueReceive(&q1, &msg, 10) != OS_QUEUE_OK)
+//			continue;
+//		if(msg.sequence != expected)
+//			Global_u32Errors++;
+//		expected = msg.sequence + 1;
+//		Global_u32Received++;
+//	}
+//}
+//void task3 (){
+//	u32 last = 0;
+//	while(1){
+//		OS_enumDelayTask(&t3, 1000);
+//		Global_u32MessagesPerSecond = Global_u32Received - last;
+//		last = Global_u32Received;
+//	}
+//}
+//
+///* Testing OS for message queue throughput
+// * T2 (receiver) has a higher priority than T1 (sender), so most messages are copied
+// * directly into the blocked receiver's buffer. T3 samples the count every 1000 ticks.
+// * Expected Output: Global_u32MessagesPerSecond holds the throughput, Global_u32Errors stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	if(OS_enumCreateQueue(&q1, q1Buffer, sizeof(Telemetry_t), 8) != OS_QUEUE_INIT_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 2 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t2.func = task2;
+//	t2.Priority = 3 ;
+//	strcpy(t2.TaskName,"Task 2");
+//	t2.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t2);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t3.func = task3;
+//	t3.Priority = 4 ;
+//	strcpy(t3.TaskName,"Task 3");
+//	t3.StackSize = 512;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t3);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	loc_enumERROR= OS_enumActivateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//	loc_enumERROR= OS_enumActivateTask(&t2);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//	loc_enumERROR= OS_enumActivateTask(&t3);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
@@ -0,0 +1,90 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "Porting_CortexM.h"
+//
+//#include "RCC_interface.h"
+//
+//OS_structTask t1,t2;
+//u8 Global_u8Task1Led;
+//volatile u32 Global_u32Task2Depth;
+//volatile OS_structTask* Global_structOverflowTask;
+//u32 Global_u32Calibration[64] __attribute__((aligned(256)));
+//volatile u32 Global_u32Sum;
+//
+///* Recurses until it reaches the stack guard of T2 */
+//u32 runaway(u32 depth){
+//	volatile u32 locals[8];
+//	locals[0] = depth;
+//	Global_u32Task2Depth = depth;
+//	return runaway(depth + 1) + locals[0];
+//}
+//void task1 (){
+//	while(1){
+//		Global_u8Task1Led ^= 1;
+//		// Reading is allowed, writing Global_u32Calibration here would raise a MemManage fault
+//		Global_u32Sum += Global_u32Calibration[0];
+//		OS_enumDelayTask(&t1, 10);
+//	}
+//}
+//void task2 (){
+//	OS_enumDelayTask(&t2, 100);
+//	runaway(0);
+//	while(1);
+//}
+//
+///* Called by MemManage_Handler when a task accesses its stack guard */
+//void OS_voidStackOverflowHook(OS_structTask* Add_structTask){
+//	Global_structOverflowTask = Add_structTask;
+//	while(1);
+//}
+//
+///* Testing OS for MPU stack guards (OS_MPU_ENABLE = 1)
+// * T2 overflows its 512 bytes stack after 100 ticks, T1 runs with read only access to a calibration table.
+// * Only core peripherals are used by the OS, so the test also runs under qemu-system-arm with a
+// * Cortex-M3 board that has an MPU (e.g. -M lm3s6965evb, OS_MPU_FLASH_BASE 0, its startup code)
+// * Expected Output: Global_structOverflowTask == &t2, Global_u32Task2Depth stops at about 10,
+// *                  the stack of T1 placed below T2 is left intact */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 3 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 512;
+//
+//	t2.func = task2;
+//	t2.Priority = 2 ;
+//	strcpy(t2.TaskName,"Task 2");
+//	t2.StackSize = 512;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t2);
+//	loc_enumERROR += OS_enumCreateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	// Regions are set after creation
+//	loc_enumERROR = OS_enumMpuSetTaskRegion(&t1, 0, (u32)Global_u32Calibration, 8, OS_MPU_READ_ONLY | OS_MPU_EXECUTE_NEVER);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&t1);
+//	OS_enumActivateTask(&t2);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
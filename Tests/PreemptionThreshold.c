@@ -0,0 +1,120 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+///* 1: the medium tasks share the threshold 4 (one non-preemptive group), 0: plain priorities */
+//#define USE_THRESHOLD   1
+//#define WORK_LOOPS      20000
+//
+//OS_structTask mediumA,mediumB,mediumC,urgent;
+//volatile OS_structTask* Global_structLast;
+//volatile u32 Global_u32Switches,Global_u32Jobs[3],Global_u32UrgentRuns,Global_u32UrgentLatency,Global_u32Errors;
+//volatile u32 Global_u32InGroup;
+//
+///* Counts the switches seen by the medium tasks and checks no member of the group preempts another */
+//static void job(u32 id){
+//	if(Global_structLast != OS_StructOS.CurrentTask){
+//		Global_structLast = OS_StructOS.CurrentTask;
+//		Global_u32Switches++;
+//	}
+//#if USE_THRESHOLD == 1
+//	if(Global_u32InGroup++)
+//		Global_u32Errors++;
+//#endif
+//	for(volatile u32 i = 0 ; i < WORK_LOOPS ; i++);
+//#if USE_THRESHOLD == 1
+//	Global_u32InGroup--;
+//#endif
+//	Global_u32Jobs[id]++;
+//}
+//
+///* Medium tasks: B activates A and C in the middle of its job, they preempt it without threshold */
+//void taskA(){ while(1){ job(0); OS_enumTerminateTask(&mediumA); } }
+//void taskC(){ while(1){ job(2); OS_enumTerminateTask(&mediumC); } }
+//void taskB(){
+//	while(1){
+//		OS_enumActivateTask(&mediumA);
+//		job(1);
+//		OS_enumActivateTask(&mediumC);
+//		job(1);
+//		OS_enumDelayTask(&mediumB, 2);
+//	}
+//}
+//
+///* Urgent task above the threshold: runs at once every tick, whatever the medium tasks do */
+//void taskUrgent(){
+//	u32 start;
+//	while(1){
+//		start = DWT->CYCCNT;
+//		OS_enumDelayTask(&urgent, 1);
+//		Global_u32UrgentLatency = DWT->CYCCNT - start;
+//		Global_u32UrgentRuns++;
+//	}
+//}
+//
+///* Testing preemption thresholds
+// * Expected Output: Global_u32Switches lower with USE_THRESHOLD 1 for the same Global_u32Jobs,
+// *                  Global_u32UrgentRuns follows the tick count in both cases, Global_u32Errors stays 0.
+// *                  The three medium tasks never preempt each other, so their stacks could be one
+// *                  stack sized for the deepest of them. */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	mediumA.func = taskA;
+//	mediumA.Priority = 3 ;
+//	strcpy(mediumA.TaskName,"Medium A");
+//	mediumA.StackSize = 256;
+//
+//	mediumB.func = taskB;
+//	mediumB.Priority = 2 ;
+//	strcpy(mediumB.TaskName,"Medium B");
+//	mediumB.StackSize = 256;
+//
+//	mediumC.func = taskC;
+//	mediumC.Priority = 4 ;
+//	strcpy(mediumC.TaskName,"Medium C");
+//	mediumC.StackSize = 256;
+//
+//#if USE_THRESHOLD == 1
+//	mediumA.PreemptionThreshold = 4;
+//	mediumB.PreemptionThreshold = 4;
+//	mediumC.PreemptionThreshold = 4;
+//#endif
+//
+//	urgent.func = taskUrgent;
+//	urgent.Priority = 6 ;
+//	strcpy(urgent.TaskName,"Urgent");
+//	urgent.StackSize = 256;
+//
+//	loc_enumERROR = OS_enumCreateTask(&mediumA);
+//	loc_enumERROR += OS_enumCreateTask(&mediumB);
+//	loc_enumERROR += OS_enumCreateTask(&mediumC);
+//	loc_enumERROR += OS_enumCreateTask(&urgent);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&mediumB);
+//	OS_enumActivateTask(&urgent);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
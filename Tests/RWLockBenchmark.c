@@ -0,0 +1,134 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "Semaphore.h"
+//#include "RWLock.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+///* 1: readers and the writer share the table through a binary semaphore, 0: through the reader-writer lock */
+//#define USE_SEMAPHORE   0
+//#define NO_OF_READERS   8
+//#define TABLE_WORDS     32
+//#define WINDOW_TICKS    1000
+//
+//OS_tstructRWLock l1;
+//OS_tstructSemaphore s1;
+//OS_structTask readers[NO_OF_READERS],writer;
+//u32 Global_u32Table[TABLE_WORDS];
+//volatile u32 Global_u32Reads[NO_OF_READERS],Global_u32Writes,Global_u32Errors;
+//volatile u32 Global_u32ReadsPerWindow,Global_u32CyclesPerRead;
+//
+//static void lockRead(){
+//#if USE_SEMAPHORE == 1
+//	OS_enumAcquireSemaphore(&s1, OS_WAIT_FOREVER);
+//#else
+//	OS_enumRWLockRead(&l1, OS_WAIT_FOREVER);
+//#endif
+//}
+//static void unlockRead(){
+//#if USE_SEMAPHORE == 1
+//	OS_enumReleaseSemaphore(&s1);
+//#else
+//	OS_voidRWLockReadUnlock(&l1);
+//#endif
+//}
+//
+///* Readers: the table is consistent when all its words are equal */
+//void reader(){
+//	u32 id = OS_StructOS.CurrentTask - readers;
+//	while(1){
+//		lockRead();
+//		u32 first = Global_u32Table[0];
+//		for(u32 i = 1 ; i < TABLE_WORDS ; i++)
+//			if(Global_u32Table[i] != first)
+//				Global_u32Errors++;
+//		unlockRead();
+//		Global_u32Reads[id]++;
+//	}
+//}
+//
+///* Writer: updates the table every 5 ticks and reports the reads done in each window */
+//void writerTask(){
+//	u32 ticks = 0, lastReads = 0, reads, start;
+//	while(1){
+//#if USE_SEMAPHORE == 1
+//		OS_enumAcquireSemaphore(&s1, OS_WAIT_FOREVER);
+//#else
+//		OS_enumRWLockWrite(&l1, OS_WAIT_FOREVER);
+//#endif
+//		Global_u32Writes++;
+//		for(u32 i = 0 ; i < TABLE_WORDS ; i++)
+//			Global_u32Table[i] = Global_u32Writes;
+//#if USE_SEMAPHORE == 1
+//		OS_enumReleaseSemaphore(&s1);
+//#else
+//		OS_voidRWLockWriteUnlock(&l1);
+//#endif
+//		OS_enumDelayTask(&writer, 5);
+//		ticks += 5;
+//		if(ticks >= WINDOW_TICKS){
+//			reads = 0;
+//			for(u32 i = 0 ; i < NO_OF_READERS ; i++)
+//				reads += Global_u32Reads[i];
+//			Global_u32ReadsPerWindow = reads - lastReads;
+//			lastReads = reads;
+//			ticks = 0;
+//			/* Cost of one uncontended read lock / unlock pair */
+//			start = DWT->CYCCNT;
+//			lockRead();
+//			unlockRead();
+//			Global_u32CyclesPerRead = DWT->CYCCNT - start;
+//		}
+//	}
+//}
+//
+///* Benchmarking read throughput of 8 readers and 1 writer, reader-writer lock against semaphore
+// * Expected Output: Global_u32ReadsPerWindow higher with USE_SEMAPHORE 0 (readers preempted inside
+// *                  the read section do not block the others), Global_u32Errors stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumInitRWLock(&l1);
+//	OS_enumInitSemaphore(&s1, 1);
+//
+//	for(u32 i = 0 ; i < NO_OF_READERS ; i++){
+//		readers[i].func = reader;
+//		readers[i].Priority = 1 ;
+//		strcpy(readers[i].TaskName,"Reader");
+//		readers[i].StackSize = 256;
+//		loc_enumERROR += OS_enumCreateTask(&readers[i]);
+//	}
+//
+//	writer.func = writerTask;
+//	writer.Priority = 2 ;
+//	strcpy(writer.TaskName,"Writer");
+//	writer.StackSize = 256;
+//	loc_enumERROR += OS_enumCreateTask(&writer);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	for(u32 i = 0 ; i < NO_OF_READERS ; i++)
+//		OS_enumActivateTask(&readers[i]);
+//	OS_enumActivateTask(&writer);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
@@ -0,0 +1,89 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "Semaphore.h"
+//#include "stm32f103xb.h"
+//
+//#define ROUNDS        1000
+//
+//OS_tstructSemaphore s1,s2;
+//OS_structTask t1,t2;
+//volatile u32 Global_u32FastAverage,Global_u32FastWorst,Global_u32SlowAverage,Global_u32Errors;
+//
+///* Uncontended: acquire + release pairs nobody else wants, no SVC is taken */
+//void task1 (){
+//	u32 start,cycles,total;
+//	while(1){
+//		total = 0;
+//		for(u32 n = 0 ; n < ROUNDS ; n++){
+//			start = DWT->CYCCNT;
+//			if(OS_enumAcquireSemaphore(&s1, OS_WAIT_FOREVER) != OS_SEMAPHORE_AVAILABLE)
+//				Global_u32Errors++;
+//			OS_enumReleaseSemaphore(&s1);
+//			cycles = DWT->CYCCNT - start;
+//			total += cycles;
+//			if(cycles > Global_u32FastWorst)
+//				Global_u32FastWorst = cycles;
+//		}
+//		Global_u32FastAverage = total / ROUNDS;
+//
+//		/* Contended: t2 holds s2, t1 blocks (slow path) until t2 hands it over */
+//		start = DWT->CYCCNT;
+//		OS_enumAcquireSemaphore(&s2, OS_WAIT_FOREVER);
+//		Global_u32SlowAverage = DWT->CYCCNT - start;
+//		OS_enumReleaseSemaphore(&s2);
+//		OS_enumDelayTask(&t1, 10);
+//	}
+//}
+//void task2 (){
+//	while(1){
+//		OS_enumAcquireSemaphore(&s2, OS_WAIT_FOREVER);
+//		OS_enumDelayTask(&t2, 1);
+//		OS_enumReleaseSemaphore(&s2);
+//		OS_enumDelayTask(&t2, 10);
+//	}
+//}
+//
+///* Benchmarking the semaphore fast path (LDREX / STREX, no SVC) against the slow path
+// * Expected Output: Global_u32FastAverage is a few tens of cycles per acquire + release pair,
+// *                  Global_u32SlowAverage includes the block, a tick and the handover */
+//int main(){
+//
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumInitSemaphore(&s1, 1);
+//	OS_enumInitSemaphore(&s2, 1);
+//
+//	t1.func = task1;
+//	t1.Priority = 2 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 512;
+//
+//	t2.func = task2;
+//	t2.Priority = 3 ;
+//	strcpy(t2.TaskName,"Task 2");
+//	t2.StackSize = 256;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	loc_enumERROR += OS_enumCreateTask(&t2);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&t1);
+//	OS_enumActivateTask(&t2);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
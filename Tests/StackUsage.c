@@ -0,0 +1,100 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "Mem_Management.h"
+//
+//#include "RCC_interface.h"
+//
+//OS_structTask t1,t2,t3;
+//u8 Global_u8Task1Led,Global_u8Task2Led;
+//volatile u32 Global_u32T1Unused,Global_u32T2Unused,Global_u32T3Unused;
+//volatile u8 Global_u8Overflow;
+//
+///* Uses about 400 bytes of stack */
+//u32 deepCall(u32 depth){
+//	volatile u32 locals[8];
+//	locals[0] = depth;
+//	if(depth == 0)
+//		return locals[0];
+//	return deepCall(depth - 1) + locals[0];
+//}
+//void task1 (){
+//	while(1){
+//		Global_u8Task1Led ^= 1;
+//		OS_enumDelayTask(&t1, 10);
+//	}
+//}
+//void task2 (){
+//	while(1){
+//		Global_u8Task2Led ^= 1;
+//		deepCall(10);
+//		OS_enumDelayTask(&t2, 10);
+//	}
+//}
+//void task3 (){
+//	while(1){
+//		// Monitor: high-water marks of every task
+//		Global_u32T1Unused = OS_u32TaskStackHighWaterMark(&t1);
+//		Global_u32T2Unused = OS_u32TaskStackHighWaterMark(&t2);
+//		Global_u32T3Unused = OS_u32TaskStackHighWaterMark(&t3);
+//		OS_enumDelayTask(&t3, 100);
+//	}
+//}
+//
+///* Called by PendSV_Handler instead of the default hook */
+//void OS_voidStackOverflowHook(OS_structTask* Add_structTask){
+//	(void)Add_structTask;
+//	Global_u8Overflow = 1;
+//	while(1);
+//}
+//
+///* Testing OS for stack usage measurement (OS_STACK_PAINT = 1, OS_STACK_CHECK = 1)
+// * All tasks get the guessed 1024 bytes, T3 reads how much of each stack was never used.
+// * Expected Output: Global_u32T1Unused close to 1024 - 100, Global_u32T2Unused about 400 bytes
+// *                  less, so T1 fits a 256 bytes class and T2 a 512 bytes one.
+// *                  Making deepCall recurse 30 times sets Global_u8Overflow at the next switch */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 3 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	t2.func = task2;
+//	t2.Priority = 3 ;
+//	strcpy(t2.TaskName,"Task 2");
+//	t2.StackSize = 1024;
+//
+//	t3.func = task3;
+//	t3.Priority = 4 ;
+//	strcpy(t3.TaskName,"Task 3");
+//	t3.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	loc_enumERROR += OS_enumCreateTask(&t2);
+//	loc_enumERROR += OS_enumCreateTask(&t3);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	OS_enumActivateTask(&t1);
+//	OS_enumActivateTask(&t2);
+//	OS_enumActivateTask(&t3);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
@@ -0,0 +1,102 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "StreamBuffer.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//OS_tstructStreamBuffer sb1;
+//u8 sb1Buffer[256];
+//OS_structTask t1,t2;
+//u8 Global_u8Task1Led;
+//volatile u32 Global_u32Produced,Global_u32Consumed,Global_u32BytesPerSecond,Global_u32Errors;
+//
+///* Producer: one byte per received UART frame, the ISR never blocks and never enters
+// * the kernel unless the reader is waiting and 16 bytes are available */
+//void USART1_IRQHandler(void){
+//	u8* span;
+//	u8 data = (u8)USART1->DR;
+//	if(OS_u32StreamBufferAcquireWrite(&sb1, &span)){
+//		*span = data;
+//		OS_voidStreamBufferCommit(&sb1, 1);
+//		Global_u32Produced++;
+//	}
+//}
+//void task1 (){
+//	const u8* span;
+//	u32 length;
+//	static u8 expected = 0;
+//	while(1){
+//		Global_u8Task1Led ^= 1;
+//		// Zero-copy read: bytes are checked in place then given back to the producer
+//		length = OS_u32StreamBufferAcquireRead(&sb1, &span, 100);
+//		for(u32 i = 0 ; i < length ; i++){
+//			if(span[i] != expected)
+//				Global_u32Errors++;
+//			expected = span[i] + 1;
+//		}
+//		OS_voidStreamBufferRelease(&sb1, length);
+//		Global_u32Consumed += length;
+//	}
+//}
+//void task2 (){
+//	u32 last = 0;
+//	while(1){
+//		OS_enumDelayTask(&t2, 1000);
+//		Global_u32BytesPerSecond = Global_u32Consumed - last;
+//		last = Global_u32Consumed;
+//	}
+//}
+//
+///* Testing OS for ISR to task streaming
+// * USART1 is looped back (TX wired to RX) and fed with an incrementing byte pattern,
+// * T1 is woken once per 16 bytes instead of once per byte. T2 samples the count every 1000 ticks.
+// * Expected Output: Global_u32BytesPerSecond holds the throughput, Global_u32Errors stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	if(OS_enumStreamBufferCreate(&sb1, sb1Buffer, sizeof(sb1Buffer), 16) != OS_STREAM_INIT_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 3 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t2.func = task2;
+//	t2.Priority = 4 ;
+//	strcpy(t2.TaskName,"Task 2");
+//	t2.StackSize = 512;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t2);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	loc_enumERROR= OS_enumActivateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//	loc_enumERROR= OS_enumActivateTask(&t2);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
@@ -13,7 +13,7 @@
 //		Global_u8Task1Led ^= 1;
 //		count++;
 //		if(count == 100){
-//			OS_enumAcquireSemaphore(&s1, &t1);
+//			OS_enumAcquireSemaphore(&s1, OS_WAIT_FOREVER);
 //			OS_enumActivateTask(&t2);
 //		}
 //		if(count == 200){
@@ -57,7 +57,7 @@
 //		Global_u8Task4Led ^= 1;
 //		count++;
 //		if(count == 3){
-//			OS_enumAcquireSemaphore(&s1, &t4);
+//			OS_enumAcquireSemaphore(&s1, OS_WAIT_FOREVER);
 //		}
 //		if(count == 200){
 //			count=0;
@@ -0,0 +1,86 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//
+//#include "RCC_interface.h"
+//
+//#define NO_OF_HANDLERS   4
+//
+//OS_structTask t1,handlers[NO_OF_HANDLERS];
+//volatile u8 Global_u8HandlerBusy[NO_OF_HANDLERS];
+//u8 Global_u8Task1Led;
+//volatile u32 Global_u32Spawned,Global_u32Finished,Global_u32Errors;
+//
+///* Connection handler: serves for a while then deletes itself, its stack goes back to the
+// * 1024 bytes size class and its structure can be created again */
+//void handler (){
+//	OS_structTask* self = OS_StructOS.CurrentTask;
+//	u32 index = self - handlers;
+//	OS_enumDelayTask(self, 5 + index * 3);
+//	Global_u32Finished++;
+//	Global_u8HandlerBusy[index] = 0;
+//	OS_enumDeleteTask(self);
+//	// Never reached
+//	Global_u32Errors++;
+//	while(1);
+//}
+//void task1 (){
+//	while(1){
+//		Global_u8Task1Led ^= 1;
+//		for(u32 i = 0 ; i < NO_OF_HANDLERS ; i++){
+//			if(Global_u8HandlerBusy[i])
+//				continue;
+//			handlers[i].func = handler;
+//			handlers[i].Priority = 2 ;
+//			strcpy(handlers[i].TaskName,"Handler");
+//			handlers[i].StackSize = 1024;
+//			if(OS_enumCreateTask(&handlers[i]) != OS_OK){
+//				Global_u32Errors++;
+//				continue;
+//			}
+//			Global_u8HandlerBusy[i] = 1;
+//			OS_enumActivateTask(&handlers[i]);
+//			Global_u32Spawned++;
+//		}
+//		OS_enumDelayTask(&t1, 10);
+//	}
+//}
+//
+///* Testing OS for task deletion
+// * T1 spawns a handler in every free slot every 10 ticks, handlers delete themselves.
+// * Only 4 handler stacks ever fit at the same time (OS_PROCESS_STACK_SIZE = 8192),
+// * so creation fails quickly if deleted stacks are not reused.
+// * Expected Output: Global_u32Spawned and Global_u32Finished keep growing, Global_u32Errors stays 0 */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 3 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	loc_enumERROR= OS_enumActivateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
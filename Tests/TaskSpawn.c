@@ -0,0 +1,85 @@
+//#include <string.h>
+//#include "STD_TYPES.h"
+//#include "BIT_MATH.h"
+//#include "Task.h"
+//#include "System.h"
+//#include "stm32f103xb.h"
+//
+//#include "RCC_interface.h"
+//
+//OS_structTask t1;
+//u8 Global_u8Task1Led;
+//volatile u32 Global_u32Spawned,Global_u32Finished,Global_u32Refused;
+//volatile u32 Global_u32SpawnWorst,Global_u32SpawnBest = 0xFFFFFFFF;
+//
+///* Request handler: serves for a few ticks then deletes itself, its task structure and its
+// * stack go back to the pools */
+//void handler (){
+//	OS_enumDelayTask(OS_StructOS.CurrentTask, 3 + (Global_u32Spawned & 7));
+//	Global_u32Finished++;
+//	OS_enumDeleteTask(OS_StructOS.CurrentTask);
+//	// Never reached
+//	while(1);
+//}
+//void task1 (){
+//	u32 start,cycles;
+//	while(1){
+//		Global_u8Task1Led ^= 1;
+//		// Spawn as many handlers as the pools allow, the service is timed by the DWT cycle counter
+//		for(u32 i = 0 ; i < 4 ; i++){
+//			start = DWT->CYCCNT;
+//			OS_enumErrorStatus loc_enumERROR = OS_enumSpawnTask(handler, 2, 1, NULL);
+//			cycles = DWT->CYCCNT - start;
+//			if(loc_enumERROR != OS_OK){
+//				Global_u32Refused++;
+//				continue;
+//			}
+//			Global_u32Spawned++;
+//			if(cycles > Global_u32SpawnWorst)
+//				Global_u32SpawnWorst = cycles;
+//			if(cycles < Global_u32SpawnBest)
+//				Global_u32SpawnBest = cycles;
+//		}
+//		OS_enumDelayTask(&t1, 10);
+//	}
+//}
+//
+///* Testing OS for task spawning
+// * T1 spawns up to 4 handlers (priority 2, 512 bytes stack class) every 10 ticks from the task
+// * pool, handlers delete themselves after 3 to 10 ticks. Spawns beyond OS_TASK_POOL_SIZE or the
+// * free stacks are refused, never blocked.
+// * Expected Output: Global_u32Spawned and Global_u32Finished keep growing and
+// *                  Global_u32SpawnWorst stays close to Global_u32SpawnBest (no table search) */
+//int main(){
+//
+//	// HW Init
+//	RCC_voidInitSysClock();
+//	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+//	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+//
+//	// Variable to define error status
+//	OS_enumErrorStatus loc_enumERROR = OS_OK;
+//
+//	loc_enumERROR = OS_enumInit();
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	t1.func = task1;
+//	t1.Priority = 3 ;
+//	strcpy(t1.TaskName,"Task 1");
+//	t1.StackSize = 1024;
+//
+//	loc_enumERROR = OS_enumCreateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//		while(1);
+//
+//	loc_enumERROR= OS_enumActivateTask(&t1);
+//	if(loc_enumERROR != OS_OK)
+//			while(1);
+//
+//	OS_enumStartOS();
+//
+//	while(1);
+//
+//
+//}
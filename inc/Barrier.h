@@ -0,0 +1,69 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Barriers to synchronize N tasks at a rendezvous    */
+/****************************************************************/
+#ifndef INC_BARRIER_H_
+#define INC_BARRIER_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Barrier Structure
+ * Tasks calling OS_enumBarrierWait block until `Parties` tasks arrived, the last one releases them
+ * all and the barrier starts a new generation at once. */
+typedef struct{
+	u32 Parties;                            // Tasks to wait for in each generation
+	u32 Arrived;                            // Tasks arrived in this generation (may count ones that timed out)
+	u32 Generation;                         // Completed generations
+	OS_structTask* WaitList;                // Tasks waiting, highest priority first (FIFO inside a priority)
+}OS_tstructBarrier;
+
+typedef enum{
+	OS_BARRIER_INIT_OK,
+	OS_BARRIER_RELEASED,                    // Released by the last task of the generation
+	OS_BARRIER_SERIAL,                      // Was the last task, released the others
+	OS_BARRIER_TIMEOUT,
+	OS_BARRIER_ERROR                        // 0 parties, or called from an interrupt handler
+}OS_tenuBarrierState;
+
+/* APIs */
+/** OS_enumInitBarrier
+ * @brief Initializes a barrier for a number of tasks.
+ *
+ * @return OS_tenuBarrierState OS_BARRIER_INIT_OK, or OS_BARRIER_ERROR if `Copy_u32Parties` is 0.
+ */
+OS_tenuBarrierState OS_enumInitBarrier(OS_tstructBarrier* Add_structBarrier, u32 Copy_u32Parties);
+/** OS_enumBarrierWait
+ * @brief Waits until all the tasks of the barrier arrived, at most a number of ticks.
+ *
+ * @param Add_structBarrier   Barrier to wait on.
+ * @param Copy_u32TicksToWait Ticks to wait, 0 to return at once if not the last, or `OS_WAIT_FOREVER`.
+ * @return OS_tenuBarrierState OS_BARRIER_SERIAL for the last task (one per generation, e.g. to
+ *         publish the frame), OS_BARRIER_RELEASED for the others, OS_BARRIER_TIMEOUT if the task
+ *         left before the generation completed.
+ *
+ * @details
+ * The function performs the following steps in one SVC (SVC_BARRIER_WAIT):
+ * 1. Counts the task. If it is not the last one, blocks it on the wait list (and the timeout list).
+ * 2. The last task checks the count against the wait list, tasks that timed out or were deleted
+ *    are not waited for. It makes every waiting task ready in one pass, starts a new generation,
+ *    and runs the scheduler once: one PendSV whatever the number of tasks released.
+ *
+ * Example usage:
+ * @code
+ * while(1){
+ *     processStage(frame);
+ *     if(OS_enumBarrierWait(&frameEnd, OS_WAIT_FOREVER) == OS_BARRIER_SERIAL)
+ *         frame = nextFrame();
+ * }
+ * @endcode
+ */
+OS_tenuBarrierState OS_enumBarrierWait(OS_tstructBarrier* Add_structBarrier, u32 Copy_u32TicksToWait);
+
+/* Kernel side, run in Handler Mode */
+OS_tenuBarrierState OS_enumBarrierWaitService(OS_tstructBarrier* Add_structBarrier, u32 Copy_u32TicksToWait);
+
+#endif /* INC_BARRIER_H_ */
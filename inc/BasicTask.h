@@ -0,0 +1,94 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Run-to-completion basic tasks on a shared stack    */
+/****************************************************************/
+#ifndef INC_BASICTASK_H_
+#define INC_BASICTASK_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Number of basic task priorities, one basic task per priority (bit of the ready bitmap) */
+#define OS_BASIC_TASK_PRIORITY_LEVELS   32
+
+/* Basic Task Structure
+ * A basic task (OSEK BCC1 like) is a function that runs to completion: it never blocks, never
+ * delays and keeps no context between two activations, so it needs no stack of its own. All
+ * basic tasks run on the main stack (MSP), above every extended task (OS_structTask). */
+typedef struct{
+	/* Entered by user */
+	void (*func)(void);              // Function of the basic task, must return
+	u8 Priority;                     // 0 (lowest) to OS_BASIC_TASK_PRIORITY_LEVELS - 1
+	u8 TaskName[30];
+	/* Not entered by user */
+	u32 NoOfRuns;                    // Completed activations, for debugging
+}OS_tstructBasicTask;
+
+/* APIs */
+/** OS_voidBasicTaskInit
+ * @brief Prepares the dispatcher interrupt of the basic tasks (called by `OS_enumInit` when
+ *        `OS_BASIC_TASK_ENABLE` is 1, the basic task APIs only exist then).
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Gives the dispatcher interrupt (`OS_BASIC_TASK_IRQn`) the priority `OS_BASIC_TASK_IRQ_PRIORITY`,
+ *    above PendSV and SysTick so basic tasks preempt every extended task, and enables it.
+ * 2. Sets CCR.USERSETMPEND so unprivileged tasks may pend it through NVIC->STIR without an SVC.
+ *    This lets them pend any other interrupt too, which is why basic tasks are off by default.
+ */
+void OS_voidBasicTaskInit();
+/** OS_enumBasicTaskCreate
+ * @brief Registers a basic task at its priority.
+ *
+ * @param Add_structTask Basic task with `func` and `Priority` set.
+ * @return OS_enumErrorStatus OS_OK, or TASK_CREATION_ERROR if the priority is out of range or
+ *         already used by another basic task.
+ *
+ * Example usage:
+ * @code
+ * OS_tstructBasicTask keyHandler = { .func = onKey, .Priority = 5 };
+ * OS_enumBasicTaskCreate(&keyHandler);
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumBasicTaskCreate(OS_tstructBasicTask* Add_structTask);
+/** OS_enumBasicTaskActivate
+ * @brief Activates a basic task: sets its bit in the ready bitmap and runs it as soon as no
+ *        higher priority basic task is running.
+ *
+ * Activations of a task that did not start yet are merged (one bit per task).
+ *
+ * @param Add_structTask Created basic task.
+ * @return OS_enumErrorStatus OS_OK, or TASK_CREATION_ERROR if the task was not created.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. From an extended task (Thread Mode): sets the bit with LDREX / STREX and pends the dispatcher
+ *    interrupt through NVIC->STIR, which preempts the task at once. No SVC and no PSP switch.
+ * 2. From a basic task of lower priority: sets the bit and calls the dispatcher, the activated
+ *    task runs nested on the same stack (a plain function call) and the caller resumes after it.
+ * 3. From a basic task of higher or equal priority: sets the bit, the dispatcher runs the task
+ *    when the caller returns.
+ * 4. From an interrupt handler: sets the bit and pends the dispatcher interrupt. If a basic task is
+ *    running, the activated one starts when it completes.
+ *
+ * Example usage:
+ * @code
+ * void EXTI0_IRQHandler(){
+ *     OS_enumBasicTaskActivate(&keyHandler);
+ * }
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumBasicTaskActivate(OS_tstructBasicTask* Add_structTask);
+/** OS_voidBasicTaskDispatch
+ * @brief Runs the ready basic tasks with a priority above the running one, highest first.
+ *
+ * Called by the dispatcher interrupt and by `OS_enumBasicTaskActivate`. Interrupts stay enabled
+ * while a basic task runs, each task is a function call on the current (main) stack, so the
+ * stack depth is the sum of the deepest basic task of each priority.
+ */
+void OS_voidBasicTaskDispatch();
+
+#endif /* INC_BASICTASK_H_ */
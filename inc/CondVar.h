@@ -0,0 +1,88 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Condition variables used with the kernel mutex     */
+/****************************************************************/
+#ifndef INC_CONDVAR_H_
+#define INC_CONDVAR_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "Semaphore.h"
+
+/* Condition Variable Structure
+ * Tasks wait on it while holding a binary semaphore (the kernel mutex), which the wait releases
+ * and retakes. The mutex of each waiter is kept in its `Waiting.Data`. */
+typedef struct{
+	OS_structTask* WaitList;                // Tasks waiting, highest priority first (FIFO inside a priority)
+}OS_tstructCondVar;
+
+typedef enum{
+	OS_CONDVAR_INIT_OK,
+	OS_CONDVAR_SIGNALED,
+	OS_CONDVAR_TIMEOUT,
+	OS_CONDVAR_NOT_OWNER,
+	OS_CONDVAR_MUTEX_LOST                   // The wait ended but the mutex could not be taken again
+}OS_tenuCondVarState;
+
+/* APIs */
+/** OS_enumInitCondVar
+ * @brief Initializes a condition variable without waiters.
+ */
+OS_tenuCondVarState OS_enumInitCondVar(OS_tstructCondVar* Add_structCondVar);
+/** OS_enumCondWait
+ * @brief Releases the mutex and waits on the condition variable in one step, then holds the
+ *        mutex again when it returns.
+ *
+ * Called by a task that owns `Add_structMutex`, never from an interrupt handler. The condition
+ * must be checked again in a loop after the call: another task may have changed it before this
+ * one got the mutex back.
+ *
+ * @param Add_structCondVar   Condition variable to wait on.
+ * @param Add_structMutex     Binary semaphore held by the running task.
+ * @param Copy_u32TicksToWait Ticks to wait for a signal, or `OS_WAIT_FOREVER`.
+ * @return OS_tenuCondVarState OS_CONDVAR_SIGNALED, OS_CONDVAR_TIMEOUT (the mutex is held in both
+ *         cases), OS_CONDVAR_NOT_OWNER if the task does not hold the mutex, or OS_CONDVAR_MUTEX_LOST
+ *         if the mutex could not be taken again (the task was activated while waiting for it), the
+ *         mutex is then not held.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. In the kernel (SVC_CONDVAR_WAIT): releases the mutex, handing it to its first waiter if any,
+ *    and blocks the task on the condition variable wait list, in the timeout list if ticks are given.
+ * 2. A signal moves the task to the wait list of the mutex, it runs again once the mutex is handed to it.
+ * 3. On timeout, takes the mutex again with `OS_enumAcquireSemaphore` before returning, and returns
+ *    OS_CONDVAR_MUTEX_LOST if that fails.
+ *
+ * Example usage:
+ * @code
+ * OS_enumAcquireSemaphore(&bufferLock, OS_WAIT_FOREVER);
+ * while(freeBuffers == 0)
+ *     OS_enumCondWait(&bufferFreed, &bufferLock, OS_WAIT_FOREVER);
+ * freeBuffers--;
+ * OS_enumReleaseSemaphore(&bufferLock);
+ * @endcode
+ */
+OS_tenuCondVarState OS_enumCondWait(OS_tstructCondVar* Add_structCondVar, OS_tstructSemaphore* Add_structMutex, u32 Copy_u32TicksToWait);
+/** OS_enumCondSignal
+ * @brief Moves the highest priority waiting task to the wait list of its mutex.
+ *
+ * The task is only made ready if the mutex is free, it then gets it at once. May be called from
+ * tasks (holding the mutex or not) and interrupt handlers.
+ */
+OS_tenuCondVarState OS_enumCondSignal(OS_tstructCondVar* Add_structCondVar);
+/** OS_enumCondBroadcast
+ * @brief Moves all the waiting tasks to the wait list of their mutex in one kernel call.
+ *
+ * Waiters are not all woken to fight for the mutex: they are queued on it by priority and each
+ * one runs when the mutex is handed to it, one context switch per waiter.
+ */
+OS_tenuCondVarState OS_enumCondBroadcast(OS_tstructCondVar* Add_structCondVar);
+
+/* Kernel side, run in Handler Mode */
+void OS_voidCondWaitService(OS_tstructCondVar* Add_structCondVar, OS_tstructSemaphore* Add_structMutex, u32 Copy_u32TicksToWait);
+void OS_voidCondSignalService(OS_tstructCondVar* Add_structCondVar, u8 Copy_u8All);
+
+#endif /* INC_CONDVAR_H_ */
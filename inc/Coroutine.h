@@ -0,0 +1,140 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Stackless coroutines multiplexed on one task       */
+/****************************************************************/
+#ifndef INC_COROUTINE_H_
+#define INC_COROUTINE_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Value returned by a coroutine function to its host */
+typedef enum{
+	OS_CO_WAITING,       // Waits for a delay, a signal or a condition (already queued by the wait macro)
+	OS_CO_YIELDED,       // Ready again, runs after the other ready coroutines
+	OS_CO_ENDED          // Reached OS_CO_END, leaves the host
+}OS_tenuCoroutineStatus;
+
+struct OS_tstructCoroutineTag;
+struct OS_tstructCoroutineHostTag;
+
+/* Coroutine Structure
+ * A coroutine is a function resumed by a switch on the line of its last wait (protothread
+ * style), it has no stack: local variables are lost at every wait, keep the state in the
+ * structure that embeds the coroutine or in the object pointed by Arg. */
+typedef struct OS_tstructCoroutineTag{
+	/* Entered by user */
+	OS_tenuCoroutineStatus (*func)(struct OS_tstructCoroutineTag* Add_structCoroutine);
+	void* Arg;                                  // Free for the application (session data...)
+	/* Not entered by user */
+	u16 Line;                                   // Resume point, 0 to start from OS_CO_BEGIN
+	u32 WakeTick;                               // Tick to leave the delayed list at
+	struct OS_tstructCoroutineTag* Next;        // Link in the ready, delayed, polled or signal waiters list
+	struct OS_tstructCoroutineHostTag* Host;    // Host running the coroutine
+}OS_tstructCoroutine;
+
+/* Coroutine Signal Structure
+ * Counting notification given by tasks and ISRs to the coroutines of one host. */
+typedef struct OS_tstructCoroutineSignalTag{
+	volatile u32 Count;                         // Signals not taken yet
+	u8 Pending;                                 // Queued in the Signaled list of the host
+	OS_tstructCoroutine* Waiters;               // Coroutines waiting, in arrival order (host only)
+	struct OS_tstructCoroutineHostTag* Host;    // Host of the waiting coroutines
+	struct OS_tstructCoroutineSignalTag* NextPending;
+}OS_tstructCoroutineSignal;
+
+/* Coroutine Host Structure
+ * State of the coroutines run by one task. Only the host task touches the lists but Signaled,
+ * which ISRs and other tasks fill with interrupts masked and the host empties with LDREX / STREX. */
+typedef struct OS_tstructCoroutineHostTag{
+	OS_tstructCoroutine* ReadyHead;             // Coroutines to run, in order
+	OS_tstructCoroutine* ReadyTail;
+	OS_tstructCoroutine* DelayedList;           // Sorted by WakeTick
+	OS_tstructCoroutine* PolledList;            // Waiting on OS_CO_WAIT_UNTIL conditions
+	OS_tstructCoroutineSignal* volatile Signaled;// Signals given since the last pass
+	OS_structTask* volatile WaitList;           // Host task blocked while no coroutine is ready
+	u32 NoOfCoroutines;
+}OS_tstructCoroutineHost;
+
+/* Coroutine body: OS_CO_BEGIN and OS_CO_END must enclose the whole function, the wait macros
+ * may not be used inside a switch of the function itself. */
+#define OS_CO_BEGIN(co)                 switch((co)->Line){ case 0:
+#define OS_CO_END(co)                   } (co)->Line = 0; return OS_CO_ENDED;
+/* Lets the other ready coroutines run */
+#define OS_CO_YIELD(co)                 do{ (co)->Line = __LINE__; return OS_CO_YIELDED; case __LINE__:; }while(0)
+/* Waits for a number of ticks */
+#define OS_CO_DELAY(co, ticks)          do{ OS_voidCoroutineDelay((co), (ticks)); (co)->Line = __LINE__; return OS_CO_WAITING; case __LINE__:; }while(0)
+/* Waits until a condition is true, checked at every pass of the host (at least every OS_COROUTINE_POLL_TICKS) */
+#define OS_CO_WAIT_UNTIL(co, cond)      do{ (co)->Line = __LINE__; case __LINE__: if(!(cond)){ OS_voidCoroutinePoll(co); return OS_CO_WAITING; } }while(0)
+/* Takes a signal, waits for it if its count is 0 */
+#define OS_CO_WAIT_SIGNAL(co, sig)      do{ if(!OS_u8CoroutineSignalTake((co), (sig))){ (co)->Line = __LINE__; return OS_CO_WAITING; case __LINE__:; } }while(0)
+
+/* APIs */
+/** OS_voidCoroutineHostInit
+ * @brief Initializes a host with no coroutine.
+ */
+void OS_voidCoroutineHostInit(OS_tstructCoroutineHost* Add_structHost);
+/** OS_enumCoroutineStart
+ * @brief Adds a coroutine to a host, it runs from OS_CO_BEGIN at the next pass of the host.
+ *
+ * Must be called by the host task itself (from a coroutine) or before the host runs.
+ *
+ * @param Add_structHost      Host that runs the coroutine.
+ * @param Add_structCoroutine Coroutine with `func` (and `Arg`) set.
+ * @return OS_enumErrorStatus OS_OK, or TASK_CREATION_ERROR if `func` is NULL.
+ */
+OS_enumErrorStatus OS_enumCoroutineStart(OS_tstructCoroutineHost* Add_structHost, OS_tstructCoroutine* Add_structCoroutine);
+/** OS_voidCoroutineRun
+ * @brief Runs the coroutines of a host forever, called by the function of the host task.
+ *
+ * @details
+ * The function performs the following steps in a loop:
+ * 1. Takes the Signaled list and gives each signal to its waiting coroutines, moves the
+ *    coroutines whose delay elapsed (`OS_StructOS.TickCount`) and the polled ones to the ready list.
+ * 2. Runs every coroutine that was ready once, in order. A yielded coroutine goes to the end of
+ *    the ready list, an ended one leaves the host.
+ * 3. If no coroutine is ready, blocks the host task until a signal is given, the first delay
+ *    elapses or `OS_COROUTINE_POLL_TICKS` pass while coroutines are polling (SVC_COROUTINE_WAIT).
+ *
+ * Example usage:
+ * @code
+ * OS_tstructCoroutineHost sessions;
+ * void sessionsTask(){
+ *     OS_voidCoroutineRun(&sessions);
+ * }
+ * @endcode
+ */
+void OS_voidCoroutineRun(OS_tstructCoroutineHost* Add_structHost);
+/** OS_voidCoroutineSignalInit
+ * @brief Initializes a signal with a count of 0 and no waiter.
+ */
+void OS_voidCoroutineSignalInit(OS_tstructCoroutineSignal* Add_structSignal);
+/** OS_voidCoroutineSignal
+ * @brief Gives a signal: the first waiting coroutine is resumed, or the count is incremented.
+ *
+ * May be called by any task, coroutine or interrupt handler. The host task is woken if it is
+ * blocked, the coroutine itself runs in the next pass of the host.
+ *
+ * Example usage:
+ * @code
+ * void USART1_IRQHandler(){
+ *     session[id].rxByte = USART1->DR;
+ *     OS_voidCoroutineSignal(&session[id].rx);
+ * }
+ * @endcode
+ */
+void OS_voidCoroutineSignal(OS_tstructCoroutineSignal* Add_structSignal);
+
+/* Used by the wait macros */
+void OS_voidCoroutineDelay(OS_tstructCoroutine* Add_structCoroutine, u32 Copy_u32NoOfTicks);
+void OS_voidCoroutinePoll(OS_tstructCoroutine* Add_structCoroutine);
+u8 OS_u8CoroutineSignalTake(OS_tstructCoroutine* Add_structCoroutine, OS_tstructCoroutineSignal* Add_structSignal);
+
+/* Kernel side, run in Handler Mode */
+void OS_voidCoroutineWaitService(OS_tstructCoroutineHost* Add_structHost, u32 Copy_u32TicksToWait);
+void OS_voidCoroutineSignalService(OS_tstructCoroutineSignal* Add_structSignal);
+
+#endif /* INC_COROUTINE_H_ */
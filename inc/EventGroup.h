@@ -0,0 +1,98 @@
+/*
+ * EventGroup.h
+ *
+ *  Created on: Dec 28, 2024
+ *      Author: mh_sm
+ */
+
+#ifndef INC_EVENTGROUP_H_
+#define INC_EVENTGROUP_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+// Event Group Structure
+typedef struct{
+	volatile u32 bits;                      // Event flags
+	OS_structTask* WaitList;                // Tasks waiting, highest priority first (FIFO inside a priority)
+}OS_tstructEvent;
+
+/* Wait request of one task, kept on its stack while it is blocked (pointed by Waiting.Data) */
+typedef struct{
+	u32 Bits;                               // Flags waited for
+	u8 WaitForAll;                          // All the flags (1) or any of them (0)
+	u8 ClearOnReturn;                       // Clears the waited flags when the wait is satisfied
+	u32 Result;                             // Flags of the group when satisfied, 0 on timeout (output)
+}OS_tstructEventWait;
+
+typedef enum{
+	OS_EVENT_NOT_SET,
+	OS_EVENT_SET,
+	OS_EVENT_INIT_OK
+}OS_tenuEventState;
+
+/* APIs */
+/** OS_enumCreateEventGroup
+ * @brief Initializes an event group with all flags cleared and no waiter.
+ */
+OS_tenuEventState OS_enumCreateEventGroup(OS_tstructEvent* Add_structEvent);
+/** OS_u32EventsWaitBits
+ * @brief Waits until any or all of the given flags are set, optionally clearing them on return.
+ *
+ * @param Add_structEvent      Event group.
+ * @param Copy_u32Bits         Flags to wait for (not 0).
+ * @param Copy_u8WaitForAll    1 to wait for all the flags, 0 for any of them.
+ * @param Copy_u8ClearOnReturn 1 to clear the flags waited for when the wait is satisfied.
+ * @param Copy_u32TicksToWait  0 to only check, `OS_WAIT_FOREVER`, or a number of ticks.
+ * @return u32 Flags of the group when the condition was met (before clearing), 0 on timeout.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Checks the condition and clears the flags in the kernel (SVC_EVENT_WAIT, or masked interrupts
+ *    in Handler Mode) so no other waiter or setter sees a half done update.
+ * 2. If it is not met and ticks are given, blocks the task on the wait list of the group with its
+ *    wait request. The task is woken by the `OS_enumSetEvent` that meets its condition, which also
+ *    fills the result, or by its timeout.
+ * 3. Interrupt handlers may only check (ticks 0).
+ *
+ * Example usage:
+ * @code
+ * u32 flags = OS_u32EventsWaitBits(&events, RX_DONE | TX_DONE, 0, 1, OS_WAIT_FOREVER);
+ * if(flags & RX_DONE) ...
+ * @endcode
+ */
+u32 OS_u32EventsWaitBits(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits, u8 Copy_u8WaitForAll, u8 Copy_u8ClearOnReturn, u32 Copy_u32TicksToWait);
+/** OS_enumSetEvent
+ * @brief Sets flags and wakes every waiter whose condition is now met, from a task or an ISR.
+ *
+ * @details
+ * The function performs the following steps (in the kernel, SVC_EVENT_SET, or through
+ * `OS_enumSetEventFromISR` in Handler Mode):
+ * 1. Sets the flags.
+ * 2. Walks the wait list once: each waiter whose condition is met gets the flags as result, leaves
+ *    the list and is made ready. The flags it asked to clear are added to a common clear mask.
+ * 3. Clears the combined mask once after the walk, so every waiter woken by the same call sees the
+ *    same flags whatever its priority, then reschedules once.
+ */
+OS_tenuEventState OS_enumSetEvent(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits);
+/** OS_enumSetEventFromISR
+ * @brief Sets flags from an interrupt handler, same steps as `OS_enumSetEvent` with interrupts masked.
+ *
+ * Example usage:
+ * @code
+ * void DMA1_Channel1_IRQHandler(){
+ *     OS_enumSetEventFromISR(&events, ADC_DONE);
+ * }
+ * @endcode
+ */
+OS_tenuEventState OS_enumSetEventFromISR(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits);
+/** OS_u32ClearEvent
+ * @brief Clears flags with LDREX / STREX (no SVC) and returns the flags before clearing.
+ */
+u32 OS_u32ClearEvent(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits);
+
+/* Kernel side, run in Handler Mode */
+void OS_voidEventWaitService(OS_tstructEvent* Add_structEvent, OS_tstructEventWait* Add_structWait, u32 Copy_u32TicksToWait);
+void OS_voidEventSetService(OS_tstructEvent* Add_structEvent, u32 Copy_u32Bits);
+
+#endif /* INC_EVENTGROUP_H_ */
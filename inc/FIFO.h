@@ -1,7 +1,7 @@
 /****************************************************************/
 /* Author  : Mohamed Abdel Hamid                                */
 /* Date    : 7 / 6 / 2024                             	        */
-/* Version : V01                                                */
+/* Version : V02                                                */
 /* Email   : mohamedhamiid20@gmail.com                          */
 /* Brief   : Handling FIFOs operations like enqueue and dequeue */
 /****************************************************************/
@@ -10,16 +10,20 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 #include "Task.h"
 #include "System.h"
-/*customer can select element type */
-#define ELEMENT_TYPE OS_structTask*
+
+/* Ring buffer of elements of any size
+ * - The capacity is a power of two so a slot is found by masking the index.
+ * - head and tail are free running counters: the FIFO holds (tail - head) elements,
+ *   so empty (tail == head) and full (tail - head == capacity) can't be confused. */
 typedef struct{
-	unsigned int counter;
-	ELEMENT_TYPE* head;
-	ELEMENT_TYPE* tail;
-	ELEMENT_TYPE* base;
-	unsigned int  length;
+	u8*  base;          // Storage of (mask + 1) * elementSize bytes
+	u32  elementSize;   // Size of one element in bytes
+	u32  mask;          // Capacity - 1
+	u32  head;          // Free running read index
+	u32  tail;          // Free running write index
 }OS_tBuffer;
 
 typedef enum{
@@ -27,43 +31,40 @@ typedef enum{
 	FIFO_FULL,
 	FIFO_EMPTY,
 	FIFO_NULL,
+	FIFO_NOT_POWER_OF_TWO
 
 }OS_enumBufferStatus;
 
+/* Initializes a FIFO over a static array, the element size and the capacity are
+ * taken from the array type at compile time */
+#define OS_FIFO_INIT(fifo, array)  OS_enumFifoInit((fifo), (array), sizeof((array)[0]), sizeof(array) / sizeof((array)[0]))
+
 /* APIs */
 /* OS_enumFifoInit
  * @brief Initializes a FIFO (First In, First Out) buffer.
  *
  * This function sets up the internal structure of the FIFO to manage a buffer of a specified length
- * and prepares it for use by resetting its pointers and counters.
+ * and prepares it for use by resetting its indices.
  *
  * @param fifo Pointer to the FIFO buffer structure to be initialized. This structure manages the buffer's state.
  * @param buff Pointer to the memory location where the actual data buffer is stored.
- *             This buffer will be used to hold the elements in the FIFO.
- * @param length Unsigned 32-bit integer representing the length of the buffer (i.e., the number of elements it can hold).
+ *             It must hold `length * elementSize` bytes and be aligned to the element size.
+ * @param elementSize Size of one element in bytes.
+ * @param length Number of elements the buffer can hold, must be a power of two.
  *
  * @return OS_enumBufferStatus An enumeration indicating the status of the initialization process:
- *         - FIFO_NULL: Indicates that the provided buffer pointer (buff) is NULL, so the initialization cannot proceed.
+ *         - FIFO_NULL: Indicates that the provided buffer pointer (buff) is NULL or the element size is 0.
+ *         - FIFO_NOT_POWER_OF_TWO: Indicates that `length` is 0 or not a power of two.
  *         - FIFO_NO_ERROR: Indicates that the FIFO was successfully initialized.
  *
- * @details
- * The function performs the following steps:
- * 1. Checks if the `buff` pointer is NULL. If it is, returns `FIFO_NULL`.
- * 2. Initializes the FIFO structure:
- *    - `fifo->base` is set to the start of the provided buffer (`buff`).
- *    - `fifo->head` is set to the start of the buffer (where new elements will be added).
- *    - `fifo->tail` is set to the start of the buffer (where elements will be removed).
- *    - `fifo->length` is set to the specified length of the buffer.
- *    - `fifo->counter` is initialized to 0, indicating that the FIFO is currently empty.
- * 3. Returns `FIFO_NO_ERROR` if the FIFO is successfully initialized.
- *
  * Example usage:
  * @code
  * OS_tBuffer myFifo;
- * ELEMENT_TYPE buffer[100];
+ * OS_structTask* buffer[128];
  * OS_enumBufferStatus status;
  *
- * status = OS_enumFifoInit(&myFifo, buffer, 100);
+ * status = OS_enumFifoInit(&myFifo, buffer, sizeof(OS_structTask*), 128);
+ * // or: status = OS_FIFO_INIT(&myFifo, buffer);
  * if (status == FIFO_NO_ERROR) {
  *     // FIFO initialized successfully, and ready for use.
  * } else {
@@ -71,14 +72,54 @@ typedef enum{
  * }
  * @endcode
  */
-OS_enumBufferStatus OS_enumFifoInit (OS_tBuffer* fifo,ELEMENT_TYPE* buff , u32 length);
+OS_enumBufferStatus OS_enumFifoInit (OS_tBuffer* fifo,void* buff , u32 elementSize, u32 length);
+/* OS_u32FifoPushN
+ * @brief Enqueues up to `count` elements in one call.
+ *
+ * The elements are copied with at most two memcpy calls, one up to the end of the
+ * storage and one for the part wrapping around to its start.
+ *
+ * @param fifo Pointer to the FIFO buffer structure to enqueue into.
+ * @param items Pointer to `count` contiguous elements.
+ * @param count Number of elements to enqueue.
+ *
+ * @return u32 Number of elements actually enqueued (limited by the free space).
+ */
+u32 OS_u32FifoPushN (OS_tBuffer* fifo,const void* items, u32 count);
+/* OS_u32FifoPopN
+ * @brief Dequeues up to `count` elements in one call.
+ *
+ * The elements are copied with at most two memcpy calls, like OS_u32FifoPushN.
+ *
+ * @param fifo Pointer to the FIFO buffer structure to dequeue from.
+ * @param items Pointer to room for `count` contiguous elements.
+ * @param count Maximum number of elements to dequeue.
+ *
+ * @return u32 Number of elements actually dequeued (limited by the stored elements).
+ */
+u32 OS_u32FifoPopN (OS_tBuffer* fifo,void* items, u32 count);
+
+/* Copies one element, word sized elements (e.g. task pointers) don't go through memcpy */
+static inline void OS_voidFifoCopyElement(void* dst, const void* src, u32 size){
+	switch(size){
+		case 4:  *(u32*)dst = *(const u32*)src; break;
+		case 2:  *(u16*)dst = *(const u16*)src; break;
+		case 1:  *(u8*)dst  = *(const u8*)src;  break;
+		default: memcpy(dst, src, size);        break;
+	}
+}
+
+/* OS_u32FifoCount
+ * @brief Returns the number of elements stored in the FIFO.
+ */
+static inline u32 OS_u32FifoCount (const OS_tBuffer* fifo){
+	return fifo->tail - fifo->head;
+}
 /* OS_enumFifoEnqueue
  * @brief Enqueues an item into the FIFO (First In, First Out) buffer.
  *
- * This function adds an item to the FIFO buffer, handling circular wrapping of the buffer.
- *
  * @param fifo Pointer to the FIFO buffer structure to enqueue into.
- * @param item The item to be enqueued into the FIFO buffer.
+ * @param item Pointer to the element to copy into the FIFO buffer.
  *
  * @return OS_enumBufferStatus An enumeration indicating the status of the enqueue operation:
  *         - FIFO_NULL: Indicates that the FIFO buffer structure is not valid.
@@ -87,22 +128,26 @@ OS_enumBufferStatus OS_enumFifoInit (OS_tBuffer* fifo,ELEMENT_TYPE* buff , u32 l
  *
  * @details
  * The function performs the following steps:
- * 1. Checks if the FIFO buffer structure is valid (i.e., `fifo->base` is not NULL and `fifo->length` is non-zero).
- *    If not, returns `FIFO_NULL`.
- * 2. Checks if the FIFO is full by comparing the head and tail pointers and the counter with the length.
- *    If full, returns `FIFO_FULL`.
- * 3. Enqueues the item by placing it at the current tail position and increments the counter.
- * 4. Updates the tail pointer to the next position, wrapping around to the base if necessary.
- * 5. Returns `FIFO_NO_ERROR` if the item was successfully enqueued.
+ * 1. Checks if the FIFO buffer structure is valid (i.e., `fifo->base` is not NULL). If not, returns `FIFO_NULL`.
+ * 2. Checks if the FIFO is full (`tail - head` greater than `mask`). If full, returns `FIFO_FULL`.
+ * 3. Copies the item into slot `tail & mask` and increments `tail`.
  */
-OS_enumBufferStatus OS_enumFifoEnqueue (OS_tBuffer* fifo,ELEMENT_TYPE item);
+static inline OS_enumBufferStatus OS_enumFifoEnqueue (OS_tBuffer* fifo,const void* item){
+	if (!fifo->base)
+		return FIFO_NULL;
+	if ((fifo->tail - fifo->head) > fifo->mask)
+		return FIFO_FULL;
+
+	OS_voidFifoCopyElement(&fifo->base[(fifo->tail & fifo->mask) * fifo->elementSize], item, fifo->elementSize);
+	fifo->tail++;
+
+	return FIFO_NO_ERROR;
+}
 /* OS_enumFifoDequeue
  * @brief Dequeues an item from the FIFO (First In, First Out) buffer.
  *
- * This function removes an item from the FIFO buffer, handling circular wrapping of the buffer.
- *
  * @param fifo Pointer to the FIFO buffer structure to dequeue from.
- * @param item Pointer to where the dequeued item will be stored.
+ * @param item Pointer to where the dequeued element will be copied.
  *
  * @return OS_enumBufferStatus An enumeration indicating the status of the dequeue operation:
  *         - FIFO_NULL: Indicates that the FIFO buffer structure is not valid.
@@ -111,36 +156,54 @@ OS_enumBufferStatus OS_enumFifoEnqueue (OS_tBuffer* fifo,ELEMENT_TYPE item);
  *
  * @details
  * The function performs the following steps:
- * 1. Checks if the FIFO buffer structure is valid (i.e., `fifo->base` is not NULL and `fifo->length` is non-zero).
- *    If not, returns `FIFO_NULL`.
- * 2. Checks if the FIFO is empty by comparing the head and tail pointers.
- *    If empty, returns `FIFO_EMPTY`.
- * 3. Dequeues the item by reading it from the current head position and decrementing the counter.
- * 4. Updates the head pointer to the next position, wrapping around to the base if necessary.
- * 5. Returns `FIFO_NO_ERROR` if the item was successfully dequeued.
+ * 1. Checks if the FIFO buffer structure is valid (i.e., `fifo->base` is not NULL). If not, returns `FIFO_NULL`.
+ * 2. Checks if the FIFO is empty (`head == tail`). If empty, returns `FIFO_EMPTY`.
+ * 3. Copies the element of slot `head & mask` to `item` and increments `head`.
  */
-OS_enumBufferStatus OS_enumFifoDequeue (OS_tBuffer* fifo,ELEMENT_TYPE* item);
+static inline OS_enumBufferStatus OS_enumFifoDequeue (OS_tBuffer* fifo,void* item){
+	if (!fifo->base)
+		return FIFO_NULL;
+	if (fifo->head == fifo->tail)
+		return FIFO_EMPTY;
+
+	OS_voidFifoCopyElement(item, &fifo->base[(fifo->head & fifo->mask) * fifo->elementSize], fifo->elementSize);
+	fifo->head++;
+
+	return FIFO_NO_ERROR;
+}
 /**
  * @brief Checks if the FIFO (First In, First Out) buffer is full.
  *
- * This function checks the status of the FIFO buffer to determine if it is full.
- *
  * @param fifo Pointer to the FIFO buffer structure to check.
  *
  * @return OS_enumBufferStatus An enumeration indicating the status of the FIFO:
- *         - FIFO_NULL: Indicates that the FIFO buffer structure is not valid (i.e., `fifo->head`, `fifo->base`, or `fifo->tail` is NULL).
+ *         - FIFO_NULL: Indicates that the FIFO buffer structure is not valid (i.e., `fifo->base` is NULL).
  *         - FIFO_FULL: Indicates that the FIFO is full.
  *         - FIFO_NO_ERROR: Indicates that the FIFO is not full.
+ */
+static inline OS_enumBufferStatus OS_enumIsFifoFull (const OS_tBuffer* fifo){
+	if(!fifo->base)
+		return FIFO_NULL;
+	if((fifo->tail - fifo->head) > fifo->mask)
+		return FIFO_FULL;
+
+	return FIFO_NO_ERROR;
+}
+/**
+ * @brief Checks if the FIFO (First In, First Out) buffer is empty.
  *
- * @details
- * The function performs the following steps:
- * 1. Checks if the FIFO buffer structure is valid (i.e., `fifo->head`, `fifo->base`, and `fifo->tail` are not NULL).
- *    If any of these pointers are NULL, returns `FIFO_NULL`.
- * 2. Checks if the FIFO is full by comparing the counter with the length.
- *    If full, returns `FIFO_FULL`.
- * 3. Returns `FIFO_NO_ERROR` if the FIFO is not full.
+ * @param fifo Pointer to the FIFO buffer structure to check.
+ *
+ * @return OS_enumBufferStatus FIFO_NULL, FIFO_EMPTY or FIFO_NO_ERROR if at least one element is stored.
  */
-OS_enumBufferStatus OS_enumIsFifoFull (OS_tBuffer* fifo);
+static inline OS_enumBufferStatus OS_enumIsFifoEmpty (const OS_tBuffer* fifo){
+	if(!fifo->base)
+		return FIFO_NULL;
+	if(fifo->head == fifo->tail)
+		return FIFO_EMPTY;
+
+	return FIFO_NO_ERROR;
+}
 
 
 #endif /* INC_FIFO_H_ */
@@ -0,0 +1,105 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Fixed-size block pools with O(1) allocate and free */
+/****************************************************************/
+#ifndef INC_MEMPOOL_H_
+#define INC_MEMPOOL_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Block sizes are rounded up to a whole number of words, a free block holds the free list link */
+#define OS_POOL_BLOCK_WORDS(blockSize)                 (((blockSize) + sizeof(u32) - 1) / sizeof(u32))
+/* Declares the (word aligned) storage of a pool of `noOfBlocks` blocks of `blockSize` bytes */
+#define OS_POOL_MEMORY(name, blockSize, noOfBlocks)    u32 name[OS_POOL_BLOCK_WORDS(blockSize) * (noOfBlocks)]
+
+/* Free block: the first word of an unused block links it to the next free one */
+typedef struct OS_structPoolBlockTag{
+	struct OS_structPoolBlockTag* Next;
+}OS_tstructPoolBlock;
+
+/* Memory Pool Structure */
+typedef struct{
+	OS_tstructPoolBlock* FreeList;   // Singly linked list of the free blocks
+	u8*  Start;                      // First byte of the storage
+	u8*  End;                        // First byte after the storage
+	u32  BlockSize;                  // Size of one block in bytes, multiple of 4
+	u32  NoOfBlocks;                 // Number of blocks in the pool
+	u32  NoOfFree;                   // Number of blocks in FreeList
+	u32  MinFree;                    // Lowest NoOfFree ever reached (high-water mark of the used blocks)
+	OS_structTask* AllocWaitList;    // Tasks blocked until a block is freed
+}OS_tstructPool;
+
+typedef enum{
+	OS_POOL_INIT_OK,
+	OS_POOL_INIT_ERROR,
+	OS_POOL_OK,
+	OS_POOL_EMPTY,
+	OS_POOL_TIMEOUT,
+	OS_POOL_INVALID_BLOCK
+}OS_tenuPoolState;
+
+/* APIs */
+/** OS_enumPoolCreate
+ * @brief Splits a static array into fixed-size blocks and links them in the free list.
+ *
+ * @param Add_structPool      Pointer to the pool structure to initialize.
+ * @param Add_voidMemory      Word aligned storage of `Copy_u32NoOfBlocks` blocks, declare it with OS_POOL_MEMORY.
+ * @param Copy_u32BlockSize   Size of one block in bytes, rounded up to a multiple of 4.
+ * @param Copy_u32NoOfBlocks  Number of blocks.
+ * @return OS_tenuPoolState OS_POOL_INIT_OK, or OS_POOL_INIT_ERROR for invalid parameters.
+ *
+ * Example usage:
+ * @code
+ * OS_tstructPool msgPool;
+ * OS_POOL_MEMORY(msgPoolMemory, sizeof(Message_t), 16);
+ * OS_enumPoolCreate(&msgPool, msgPoolMemory, sizeof(Message_t), 16);
+ * @endcode
+ */
+OS_tenuPoolState OS_enumPoolCreate(OS_tstructPool* Add_structPool, void* Add_voidMemory, u32 Copy_u32BlockSize, u32 Copy_u32NoOfBlocks);
+/** OS_enumPoolAlloc
+ * @brief Takes a block from the pool in O(1).
+ *
+ * From a task the call goes through SVC_POOL_ALLOC and may block until another task or an ISR
+ * frees a block. From an ISR the free list is accessed directly with interrupts masked and
+ * the call never blocks.
+ *
+ * @param Add_structPool      Pointer to the pool.
+ * @param Add_pvBlock         Receives the address of the block (NULL if none).
+ * @param Copy_u32TicksToWait Ticks to wait while the pool is empty, 0 to return at once or
+ *                            `OS_WAIT_FOREVER` (ignored in an ISR).
+ * @return OS_tenuPoolState
+ *         - OS_POOL_OK: A block is allocated.
+ *         - OS_POOL_EMPTY: No free block and no wait was requested.
+ *         - OS_POOL_TIMEOUT: No block was freed before the timeout.
+ */
+OS_tenuPoolState OS_enumPoolAlloc(OS_tstructPool* Add_structPool, void** Add_pvBlock, u32 Copy_u32TicksToWait);
+/** OS_enumPoolFree
+ * @brief Gives a block back to the pool in O(1).
+ *
+ * If a task is blocked in OS_enumPoolAlloc the block is handed directly to it. Callable from
+ * tasks (through SVC_POOL_FREE) and from ISRs.
+ *
+ * @param Add_structPool Pointer to the pool the block was allocated from.
+ * @param Add_voidBlock  Block to free.
+ * @return OS_tenuPoolState OS_POOL_OK, or OS_POOL_INVALID_BLOCK if the address is not the start
+ *         of a block of this pool.
+ */
+OS_tenuPoolState OS_enumPoolFree(OS_tstructPool* Add_structPool, void* Add_voidBlock);
+/** OS_u32PoolFreeBlocks
+ * @brief Returns the number of blocks currently free.
+ */
+u32 OS_u32PoolFreeBlocks(const OS_tstructPool* Add_structPool);
+/** OS_u32PoolHighWaterMark
+ * @brief Returns the largest number of blocks ever allocated at the same time, used to size pools.
+ */
+u32 OS_u32PoolHighWaterMark(const OS_tstructPool* Add_structPool);
+
+/* Kernel side of the APIs, run in Handler Mode */
+void OS_voidPoolAllocService(OS_tstructPool* Add_structPool, void** Add_pvBlock, u32 Copy_u32TicksToWait);
+void OS_voidPoolFreeService(OS_tstructPool* Add_structPool, void* Add_voidBlock);
+
+#endif /* INC_MEMPOOL_H_ */
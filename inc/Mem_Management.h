@@ -9,8 +9,28 @@
 #ifndef INC_MEM_MANAGEMENT_H_
 #define INC_MEM_MANAGEMENT_H_
 
+#include "STD_TYPES.h"
+#include "Task.h"
+#include "MyRTOSConfig.h"
+
 /* Used in creating main stack */
 #define OS_MAIN_STACK_SIZE    3072 // 3KB
+/* Pattern of never used stack words, and word kept at the lowest address of every task stack */
+#define OS_STACK_PAINT_VALUE      0xA5A5A5A5
+#define OS_STACK_CANARY_VALUE     0xC0DEFACE
+/* Bytes at the bottom of every task stack the task must not use, and alignment of task stacks */
+#if OS_MPU_ENABLE == 1
+#define OS_STACK_GUARD_SIZE       32   // Smallest MPU region
+#define OS_STACK_ALIGNMENT        OS_STACK_GUARD_SIZE
+#elif OS_PORT == OS_PORT_CORTEX_M33
+#define OS_STACK_GUARD_SIZE       8    // Canary word, PSPLIM is a multiple of 8
+#define OS_STACK_ALIGNMENT        8
+#else
+#define OS_STACK_GUARD_SIZE       4    // Canary word
+#define OS_STACK_ALIGNMENT        8
+#endif
+/* Number of task stack size classes */
+#define OS_STACK_NO_OF_CLASSES    (OS_STACK_MAX_CLASS_LOG2 - OS_STACK_MIN_CLASS_LOG2 + 1)
 
 /** OS_enumCreateStack
  * @brief Creates a stack frame for a new task.
@@ -32,8 +52,13 @@
  *    - PC: Sets the Program Counter to the task's function address.
  *    - LR: Sets the Link Register to 0xFFFFFFFD (indicating Thread mode with PSP).
  *    - R12, R3, R2, R1, R0, R4, R5, R6, R7, R8, R9, R10, R11: Sets these registers to 0.
+ *    - Cortex-M4F: EXC_RETURN 0xFFFFFFFD between R0 and R11, saved and restored by PendSV_Handler
+ *      (the first switch to a task restores no FPU context).
  * 3. The stack pointer (`CurrentPSP`) is decremented as values are pushed onto the stack.
- * 4. Returns `OS_OK` to indicate successful stack creation.
+ * 4. Fills the rest of the stack with `OS_STACK_PAINT_VALUE` if `OS_STACK_PAINT` is 1.
+ * 5. Writes `OS_STACK_CANARY_VALUE` at the lowest stack word (`_E_PSP_Task`).
+ *    With `OS_MPU_ENABLE`, also computes the MPU regions of the task (`OS_voidMpuTaskInit`).
+ * 6. Returns `OS_OK` to indicate successful stack creation.
  *
  * Example usage:
  * @code
@@ -70,6 +95,116 @@ OS_enumErrorStatus OS_enumCreateMainStack();
  * @endcode
  */
 OS_enumErrorStatus OS_enumCreateStack(OS_structTask* Add_structTask);
+/** OS_enumStackAlloc
+ * @brief Gives a task a stack of `StackSize` bytes rounded up to a power of two size class.
+ *
+ * Stacks of deleted tasks are reused first, new stacks are cut below the last one and checked
+ * against the process stack region (`OS_PROCESS_STACK_SIZE` bytes below the main stack).
+ *
+ * @param Add_structTask Task whose `StackSize` is set, `_S_PSP_Task` and `_E_PSP_Task` are filled.
+ * @return OS_enumErrorStatus OS_OK, or OS_EXCEED_AVAILABLE_STACK if the size is 0, above the biggest
+ *         class or the process stack region is full.
+ */
+OS_enumErrorStatus OS_enumStackAlloc(OS_structTask* Add_structTask);
+/** OS_enumStackPoolAlloc
+ * @brief Gives a spawned task a stack of `StackSize` bytes rounded up to a size class, taken from
+ *        the stack pool in O(1). Created tasks never take these stacks.
+ *
+ * @param Add_structTask Task whose `StackSize` is set, `_S_PSP_Task` and `_E_PSP_Task` are filled.
+ * @return OS_enumErrorStatus OS_OK, or OS_EXCEED_AVAILABLE_STACK if the size is above the biggest
+ *         class or no pool stack of its class is free.
+ */
+OS_enumErrorStatus OS_enumStackPoolAlloc(OS_structTask* Add_structTask);
+/** OS_voidStackFree
+ * @brief Gives the stack of a deleted task back to its size class for the next created task, or
+ *        to the stack pool for the next spawned task if it came from it.
+ */
+void OS_voidStackFree(OS_structTask* Add_structTask);
+/** OS_u32TaskStackHighWaterMark
+ * @brief Returns the smallest number of stack bytes a task ever had left (its stack high-water mark).
+ *
+ * Needs `OS_STACK_PAINT` set to 1: the stack is painted when the task is created and the words
+ * above the canary still holding the paint pattern are counted, one word at a time. Running every
+ * path of a task then reading this value tells how much its `StackSize` can be reduced (keep a
+ * margin for interrupts, their frame is pushed on the task stack).
+ *
+ * @param Add_structTask Created task.
+ * @return u32 Bytes never used, 0 if the stack overflowed (canary overwritten).
+ *
+ * Example usage:
+ * @code
+ * u32 unused = OS_u32TaskStackHighWaterMark(&t1);
+ * // t1.StackSize - unused bytes were used at worst
+ * @endcode
+ */
+u32 OS_u32TaskStackHighWaterMark(OS_structTask* Add_structTask);
+/** OS_enumStackPoolInit
+ * @brief Cuts `OS_STACK_POOL_BLOCKS` stacks of each size class and puts them in the stack pool
+ *        free lists, so tasks spawned later get a stack in O(1) without cutting the process stack
+ *        region. The pool is reserved for spawned tasks, created tasks never take its stacks.
+ *
+ * @return OS_enumErrorStatus OS_OK, or OS_EXCEED_AVAILABLE_STACK if they do not fit.
+ */
+OS_enumErrorStatus OS_enumStackPoolInit();
+
+/* Heap statistics */
+typedef struct{
+	u32 TotalBytes;            // Bytes usable by allocations in all regions
+	u32 FreeBytes;             // Bytes free now
+	u32 MinEverFreeBytes;      // Lowest FreeBytes ever reached
+	u32 LargestFreeBlock;      // Biggest allocation that can succeed now
+	u32 FragmentationPercent;  // 0 when all free bytes are in one block, near 100 when they are scattered
+}OS_tstructHeapStats;
+
+/** OS_enumHeapInit
+ * @brief Resets the heap and adds the default region of `OS_HEAP_SIZE` bytes, called by OS_enumInit.
+ *
+ * @return OS_enumErrorStatus OS_OK, or HEAP_INIT_ERROR if the default region is too small.
+ */
+OS_enumErrorStatus OS_enumHeapInit();
+/** OS_enumHeapAddRegion
+ * @brief Gives one more memory region to the heap (e.g. a second RAM bank).
+ *
+ * Must be called before OS_enumStartOS (or from Handler Mode) since it masks interrupts.
+ *
+ * @param Add_voidRegion Start of the region.
+ * @param Copy_u32Size   Size of the region in bytes.
+ * @return OS_enumErrorStatus OS_OK, or HEAP_INIT_ERROR if the region is NULL or too small.
+ *
+ * Example usage:
+ * @code
+ * static u8 ccmHeap[8192];
+ * OS_enumHeapAddRegion(ccmHeap, sizeof(ccmHeap));
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumHeapAddRegion(void* Add_voidRegion, u32 Copy_u32Size);
+/** OS_pvMalloc
+ * @brief Allocates a block of at least `Copy_u32Size` bytes, aligned to 8 bytes.
+ *
+ * The heap is a Two Level Segregated Fit allocator: allocation and free take a bounded
+ * number of steps whatever the heap state, so they can be used by real-time tasks and ISRs.
+ *
+ * @param Copy_u32Size Number of bytes needed.
+ * @return void* Address of the block, or NULL if no free block is big enough.
+ */
+void* OS_pvMalloc(u32 Copy_u32Size);
+/** OS_voidFree
+ * @brief Gives a block returned by OS_pvMalloc back to the heap, merging it with its free neighbours.
+ *
+ * @param Add_voidBlock Block to free, NULL is ignored.
+ */
+void  OS_voidFree(void* Add_voidBlock);
+/** OS_voidHeapGetStats
+ * @brief Reads the free bytes, the largest free block and the fragmentation of the heap.
+ *
+ * @param Add_structStats Structure to fill.
+ */
+void  OS_voidHeapGetStats(OS_tstructHeapStats* Add_structStats);
+
+/* Kernel side of the APIs, run in Handler Mode */
+void* OS_pvHeapAllocService(u32 Copy_u32Size);
+void  OS_voidHeapFreeService(void* Add_voidBlock);
+void  OS_voidHeapStatsService(OS_tstructHeapStats* Add_structStats);
 
 
 #endif /* INC_MEM_MANAGEMENT_H_ */
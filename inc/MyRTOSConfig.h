@@ -10,10 +10,70 @@
 #define INC_MYRTOSCONFIG_H_
 
 
+/* Port of the kernel: OS_PORT_CORTEX_M3, OS_PORT_CORTEX_M4F (Porting_CortexM.c) or
+ * OS_PORT_CORTEX_M33 (Porting_CortexM33.c) */
+#define OS_PORT_CORTEX_M3          0
+#define OS_PORT_CORTEX_M33         1
+#define OS_PORT_CORTEX_M4F         2
+#define OS_PORT                    OS_PORT_CORTEX_M3
 #define OS_TICK_TIME_IN_MS         1
 #define OS_CPU_CLOCK_FREQ_IN_MHZ   12065
 #define OS_LOWEST_PRIORITY         255
 #define OS_HIGHEST_PRIORITY        0
+/* Number of ready queues, must be a multiple of 8 and at most 64 (8 clusters of 8 levels) */
+#define OS_TASK_PRIORITY_LEVELS    64
+/* Size in bytes of the default heap region, 0 to only use regions given to OS_enumHeapAddRegion */
+#define OS_HEAP_SIZE               4096
+/* Heap blocks are smaller than 2^OS_HEAP_FL_MAX_LOG2 bytes, bigger regions are split in several blocks */
+#define OS_HEAP_FL_MAX_LOG2        16
+/* Bytes reserved below the main stack for all task stacks (the linker script must leave them free) */
+#define OS_PROCESS_STACK_SIZE      8192
+/* Task stacks are rounded up to a power of two size class from 2^MIN to 2^MAX bytes,
+ * stacks of deleted tasks are reused by tasks of the same class */
+#define OS_STACK_MIN_CLASS_LOG2    8
+#define OS_STACK_MAX_CLASS_LOG2    13
+/* Task structures owned by the kernel for OS_enumSpawnTask */
+#define OS_TASK_POOL_SIZE          8
+/* Stacks cut at init for each size class (from 2^MIN to 2^MAX bytes), they are reserved for
+ * OS_enumSpawnTask (taken in O(1)) and must fit OS_PROCESS_STACK_SIZE with the created tasks */
+#define OS_STACK_POOL_BLOCKS       { 0, 2, 2, 0, 0, 0 }
+/* 1: fill task stacks with a pattern when they are created so OS_u32TaskStackHighWaterMark can
+ * measure them (task creation then takes time proportional to the stack size) */
+#define OS_STACK_PAINT             1
+/* 1: PendSV_Handler checks the stack pointer and the canary word at the bottom of the stack of
+ * the task it switches out, and calls OS_voidStackOverflowHook on overflow (Cortex-M3 port, the
+ * Cortex-M33 port checks every push against PSPLIM, in hardware and in PendSV_Handler) */
+#define OS_STACK_CHECK             1
+/* 1: basic tasks (BasicTask.c), OS_enumInit enables their dispatcher interrupt and sets
+ * CCR.USERSETMPEND, which lets unprivileged tasks pend any interrupt through NVIC->STIR
+ * (keep 0 when the MPU isolates tasks and no basic task is used) */
+#define OS_BASIC_TASK_ENABLE       0
+/* Interrupt line (unused by the application) whose handler dispatches the basic tasks, and its
+ * priority: above PendSV and SysTick (15), below the interrupts that must not wait for basic tasks */
+#if OS_PORT == OS_PORT_CORTEX_M3
+#define OS_BASIC_TASK_IRQn         CAN1_SCE_IRQn
+#define OS_BASIC_TASK_IRQHandler   CAN1_SCE_IRQHandler
+#else
+/* First device interrupt of ARMCM4_FP.h and ARMCM33.h */
+#define OS_BASIC_TASK_IRQn         Interrupt0_IRQn
+#define OS_BASIC_TASK_IRQHandler   Interrupt0_Handler
+#endif
+#define OS_BASIC_TASK_IRQ_PRIORITY 14
+/* Ticks between two checks of the OS_CO_WAIT_UNTIL conditions while a coroutine host has nothing else to do */
+#define OS_COROUTINE_POLL_TICKS    1
+/* 1: a waiting writer keeps new readers of a reader-writer lock out (writers never starve),
+ * 0: readers enter while others read and writers wait until no reader is left */
+#define OS_RWLOCK_WRITER_PREFERENCE 1
+/* 1: use the Cortex-M3 / M4F MPU (not the Cortex-M33 port): a no-access guard region at the bottom of every task stack and up to
+ * two data regions per task, reprogrammed by PendSV_Handler (stacks are then aligned to 32 bytes) */
+#define OS_MPU_ENABLE              0
+/* Regions given to every task when the MPU is used: code (read only), SRAM and peripherals (read write) */
+#define OS_MPU_FLASH_BASE          0x08000000
+#define OS_MPU_FLASH_SIZE_LOG2     17
+#define OS_MPU_SRAM_BASE           0x20000000
+#define OS_MPU_SRAM_SIZE_LOG2      15
+#define OS_MPU_PERIPH_BASE         0x40000000
+#define OS_MPU_PERIPH_SIZE_LOG2    29
 
 
 #endif /* INC_MYRTOSCONFIG_H_ */
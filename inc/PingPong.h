@@ -0,0 +1,98 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Zero-copy ping-pong (N buffers) handoff from a DMA */
+/*           interrupt to one consumer task                     */
+/****************************************************************/
+#ifndef INC_PINGPONG_H_
+#define INC_PINGPONG_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Ping-Pong Structure
+ * The DMA fills the buffers in a circle, buffer (FillIndex % NoOfBuffers) is the one it is
+ * writing now. The ISR only writes FillIndex and OverrunCount, the consumer only writes
+ * ReadIndex and BorrowedIndex, so no critical section is needed to hand a buffer over. */
+typedef struct{
+	u8*  Buffers;                            // NoOfBuffers * BufferSize bytes given by the user
+	u32  BufferSize;                         // Size of one buffer in bytes
+	u32  NoOfBuffers;                        // At least 2
+	volatile u32 FillIndex;                  // Free running count of filled buffers, written by the ISR only
+	volatile u32 OverrunCount;               // Buffers overwritten before being released, written by the ISR only
+	volatile u32 ReadIndex;                  // Free running count of released buffers, written by the consumer only
+	u32  BorrowedIndex;                      // Buffer held by the consumer
+	OS_structTask* volatile ConsumerWaitList;// Consumer blocked until a buffer is filled
+}OS_tstructPingPong;
+
+typedef enum{
+	OS_PINGPONG_INIT_OK,
+	OS_PINGPONG_INIT_ERROR,
+	OS_PINGPONG_OK,
+	OS_PINGPONG_EMPTY,
+	OS_PINGPONG_OVERRUN
+}OS_tenuPingPongState;
+
+/* APIs */
+/** OS_enumPingPongCreate
+ * @brief Initializes a ping-pong object over the DMA target memory.
+ *
+ * @param Add_structPingPong  Pointer to the ping-pong structure to initialize.
+ * @param Add_u8Buffers       DMA target of `Copy_u32NoOfBuffers * Copy_u32BufferSize` bytes.
+ * @param Copy_u32BufferSize  Size of one buffer in bytes (the DMA transfer size between two interrupts).
+ * @param Copy_u32NoOfBuffers Number of buffers, 2 for the usual half/complete ping-pong.
+ * @return OS_tenuPingPongState OS_PINGPONG_INIT_OK, or OS_PINGPONG_INIT_ERROR for invalid parameters.
+ *
+ * Example usage:
+ * @code
+ * OS_tstructPingPong adc;
+ * u16 adcSamples[2][256];
+ * OS_enumPingPongCreate(&adc, (u8*)adcSamples, sizeof(adcSamples[0]), 2);
+ * // DMA in circular mode over adcSamples, half and complete interrupts enabled
+ * @endcode
+ */
+OS_tenuPingPongState OS_enumPingPongCreate(OS_tstructPingPong* Add_structPingPong, u8* Add_u8Buffers, u32 Copy_u32BufferSize, u32 Copy_u32NoOfBuffers);
+
+/* Producer side (DMA ISR) */
+/** OS_voidPingPongBufferFilledFromISR
+ * @brief Hands the buffer the DMA just finished over to the consumer.
+ *
+ * Called once per DMA half transfer / transfer complete interrupt. Counts an overrun when the
+ * DMA moves on to a buffer the consumer has not released yet, and wakes the consumer through
+ * the scheduler's OS_MarkTaskReady path if it is blocked.
+ *
+ * @param Add_structPingPong Pointer to the ping-pong object.
+ */
+void OS_voidPingPongBufferFilledFromISR(OS_tstructPingPong* Add_structPingPong);
+
+/* Consumer side (one task) */
+/** OS_enumPingPongBorrow
+ * @brief Gives the consumer the oldest filled buffer in place, without copying it.
+ *
+ * If the consumer fell behind, the buffers the DMA is overwriting are skipped and the newest
+ * complete ones are returned first.
+ *
+ * @param Add_structPingPong  Pointer to the ping-pong object.
+ * @param Add_pvBuffer        Receives the address of the filled buffer.
+ * @param Copy_u32TicksToWait Ticks to wait for a filled buffer, 0 to return at once or `OS_WAIT_FOREVER`.
+ * @return OS_tenuPingPongState
+ *         - OS_PINGPONG_OK: A buffer is borrowed.
+ *         - OS_PINGPONG_OVERRUN: A buffer is borrowed but older ones were lost.
+ *         - OS_PINGPONG_EMPTY: No buffer was filled before the timeout.
+ */
+OS_tenuPingPongState OS_enumPingPongBorrow(OS_tstructPingPong* Add_structPingPong, void** Add_pvBuffer, u32 Copy_u32TicksToWait);
+/** OS_enumPingPongRelease
+ * @brief Gives the borrowed buffer back to the DMA.
+ *
+ * @param Add_structPingPong Pointer to the ping-pong object.
+ * @return OS_tenuPingPongState OS_PINGPONG_OK, or OS_PINGPONG_OVERRUN if the DMA started
+ *         overwriting the buffer while it was borrowed (its content can't be trusted).
+ */
+OS_tenuPingPongState OS_enumPingPongRelease(OS_tstructPingPong* Add_structPingPong);
+
+/* Kernel side of the APIs, run in Handler Mode by OS_voidSvcServices */
+void OS_voidPingPongWaitService(OS_tstructPingPong* Add_structPingPong, u32 Copy_u32TicksToWait);
+
+#endif /* INC_PINGPONG_H_ */
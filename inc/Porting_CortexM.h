@@ -9,8 +9,16 @@
 #define INC_CORTEXM_OS_PORTING_H_
 
 #include "STD_TYPES.h"
+#include "MyRTOSConfig.h"
+#if OS_PORT == OS_PORT_CORTEX_M33
+#include "Porting_CortexM33.h"
+#elif OS_PORT == OS_PORT_CORTEX_M4F
+#include "ARMCM4_FP.h"
+#else
 #include "stm32f103xb.h"
 #include "core_cm3.h"
+#endif
+#include "Task.h"
 
 
 /**
@@ -43,8 +51,80 @@
  * @brief Macro to trigger a PendSV exception.
  */
 #define OS_TRIGGER_PENDSV()           SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
+/**
+ * @brief Macros to protect kernel data from interrupts, usable in Handler Mode only
+ *        (tasks run unprivileged and must go through an SVC instead).
+ *        PRIMASK is saved in 'state' so critical sections can nest.
+ */
+#define OS_ENTER_CRITICAL(state)      do{ (state) = __get_PRIMASK(); __disable_irq(); }while(0)
+#define OS_EXIT_CRITICAL(state)       __set_PRIMASK(state)
+/**
+ * @brief Macro returning non zero when called from Handler Mode (an ISR or a kernel handler).
+ */
+#define OS_IS_HANDLER_MODE()          (__get_IPSR() != 0)
+/**
+ * @brief Sets the lowest address the PSP may reach for a task (hardware stack limit, ARMv8-M only).
+ */
+#ifndef OS_SET_PSP_LIMIT
+#define OS_SET_PSP_LIMIT(task)
+#endif
+/**
+ * @brief Expands a macro value to a string, used to give configuration values to assembly code.
+ */
+#define OS_STR(x)                     #x
+#define OS_XSTR(x)                    OS_STR(x)
 
 
 void OS_voidHwInit();
 void OS_voidStartTimer();
+/** OS_voidStackOverflowHook
+ * @brief Called with the task that overflowed its stack: by PendSV_Handler (`OS_STACK_CHECK` = 1)
+ *        or MemManage_Handler (`OS_MPU_ENABLE` = 1) on Cortex-M3, by UsageFault_Handler or
+ *        PendSV_Handler (PSPLIM) on Cortex-M33.
+ *
+ * Weak, the application may redefine it to log the task name or reset the system, it must not return.
+ */
+void OS_voidStackOverflowHook(OS_structTask* Add_structTask);
+
+#if OS_MPU_ENABLE == 1
+/* Access of a task to a region (RASR AP field, privileged code always reads and writes) */
+#define OS_MPU_NO_ACCESS              (1UL << MPU_RASR_AP_Pos)
+#define OS_MPU_READ_ONLY              (2UL << MPU_RASR_AP_Pos)
+#define OS_MPU_READ_WRITE             (3UL << MPU_RASR_AP_Pos)
+/* May be added to the access of a data region */
+#define OS_MPU_EXECUTE_NEVER          MPU_RASR_XN_Msk
+
+/** OS_voidMpuInit
+ * @brief Programs the regions shared by all tasks and the regions of the first task, then enables
+ *        the MPU (called by `OS_enumStartOS`).
+ */
+void OS_voidMpuInit();
+/** OS_voidMpuTaskInit
+ * @brief Computes the RBAR / RASR values of the stack guard of a task and clears its data regions
+ *        (called by `OS_enumCreateStack`).
+ */
+void OS_voidMpuTaskInit(OS_structTask* Add_structTask);
+/** OS_enumMpuSetTaskRegion
+ * @brief Gives a task a data region with its own access rights.
+ *
+ * The RBAR / RASR values are computed here and only copied by PendSV_Handler when the task is
+ * switched in, so the change applies from the next switch to the task. Data regions override the
+ * SRAM and peripheral regions shared by all tasks and are overridden by the stack guard.
+ *
+ * @param Add_structTask  Created task (regions are cleared when it is created).
+ * @param Copy_u8Region   0 or 1 (MPU regions 5 and 6).
+ * @param Copy_u32Base    Base address, aligned to the region size.
+ * @param Copy_u8SizeLog2 Region size is 2^Copy_u8SizeLog2 bytes, at least 32 bytes (5).
+ * @param Copy_u32Access  OS_MPU_NO_ACCESS, OS_MPU_READ_ONLY or OS_MPU_READ_WRITE, optionally with
+ *                        OS_MPU_EXECUTE_NEVER, or 0 to disable the region.
+ * @return OS_enumErrorStatus OS_OK, or TASK_CREATION_ERROR for an invalid region.
+ *
+ * Example usage:
+ * @code
+ * // t1 may only read the 256 bytes of calibration data
+ * OS_enumMpuSetTaskRegion(&t1, 0, (u32)calibration, 8, OS_MPU_READ_ONLY | OS_MPU_EXECUTE_NEVER);
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumMpuSetTaskRegion(OS_structTask* Add_structTask, u8 Copy_u8Region, u32 Copy_u32Base, u8 Copy_u8SizeLog2, u32 Copy_u32Access);
+#endif
 #endif /* INC_CORTEXM_OS_PORTING_H_ */
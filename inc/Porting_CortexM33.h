@@ -0,0 +1,25 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Handling Ports according to ARM CortexM33 (ARMv8-M)*/
+/****************************************************************/
+#ifndef INC_PORTING_CORTEXM33_H_
+#define INC_PORTING_CORTEXM33_H_
+
+/* Included by Porting_CortexM.h when OS_PORT is OS_PORT_CORTEX_M33, the macros of
+ * Porting_CortexM.h are the same on ARMv8-M Mainline */
+#include "ARMCM33.h"
+
+#if OS_MPU_ENABLE == 1
+#error "The Cortex-M33 port uses PSPLIM for stack overflow detection, OS_MPU_ENABLE must be 0"
+#endif
+
+/**
+ * @brief Sets PSPLIM above the canary word of the task stack, a push below it raises a UsageFault
+ *        (STKOF) before any other memory is written.
+ */
+#define OS_SET_PSP_LIMIT(task)        __set_PSPLIM((task)->_E_PSP_Task + OS_STACK_GUARD_SIZE)
+
+#endif /* INC_PORTING_CORTEXM33_H_ */
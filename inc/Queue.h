@@ -0,0 +1,84 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Message queues for inter-task communication        */
+/****************************************************************/
+#ifndef INC_QUEUE_H_
+#define INC_QUEUE_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Queue Structure
+ * Items are copied by value into a ring of Length slots of ItemSize bytes each */
+typedef struct{
+	u8*  Buffer;                       // Storage of Length * ItemSize bytes given by the user
+	u32  ItemSize;                     // Size of one message in bytes
+	u32  Length;                       // Maximum number of messages
+	u32  Count;                        // Number of messages currently stored
+	u32  Head;                         // Slot of the oldest message
+	u32  Tail;                         // Slot of the next message to be written
+	OS_structTask* SendWaitList;       // Senders blocked on a full queue (priority ordered)
+	OS_structTask* ReceiveWaitList;    // Receivers blocked on an empty queue (priority ordered)
+}OS_tstructQueue;
+
+typedef enum{
+	OS_QUEUE_INIT_OK,
+	OS_QUEUE_INIT_ERROR,
+	OS_QUEUE_OK,
+	OS_QUEUE_FULL,
+	OS_QUEUE_EMPTY,
+	OS_QUEUE_TIMEOUT
+}OS_tenuQueueState;
+
+/* APIs */
+/** OS_enumCreateQueue
+ * @brief Initializes a message queue over a user provided buffer.
+ *
+ * @param Add_structQueue   Pointer to the queue structure to initialize.
+ * @param Add_voidBuffer    Storage for the messages, at least `Copy_u32ItemSize * Copy_u32Length` bytes.
+ * @param Copy_u32ItemSize  Size of one message in bytes.
+ * @param Copy_u32Length    Maximum number of messages the queue holds.
+ * @return OS_tenuQueueState OS_QUEUE_INIT_OK, or OS_QUEUE_INIT_ERROR for a NULL buffer or a zero size.
+ *
+ * Example usage:
+ * @code
+ * OS_tstructQueue q1;
+ * u32 q1Buffer[10];
+ * OS_enumCreateQueue(&q1, q1Buffer, sizeof(u32), 10);
+ * @endcode
+ */
+OS_tenuQueueState OS_enumCreateQueue(OS_tstructQueue* Add_structQueue, void* Add_voidBuffer, u32 Copy_u32ItemSize, u32 Copy_u32Length);
+/** OS_enumQueueSend
+ * @brief Copies a message into the queue, blocking while it is full.
+ *
+ * If a receiver is already blocked on the queue the message is copied straight into the
+ * receiver's buffer without passing through the ring. Blocked senders are served in
+ * priority order once space is available.
+ *
+ * @param Add_structQueue      Pointer to the queue.
+ * @param Add_voidItem         Message to copy (`ItemSize` bytes).
+ * @param Copy_u32TicksToWait  Ticks to wait while the queue is full, 0 to return at once or `OS_WAIT_FOREVER`.
+ * @return OS_tenuQueueState OS_QUEUE_OK, OS_QUEUE_FULL (no wait requested) or OS_QUEUE_TIMEOUT.
+ */
+OS_tenuQueueState OS_enumQueueSend(OS_tstructQueue* Add_structQueue, const void* Add_voidItem, u32 Copy_u32TicksToWait);
+/** OS_enumQueueReceive
+ * @brief Copies the oldest message out of the queue, blocking while it is empty.
+ *
+ * Blocked receivers are served in priority order. Receiving from a full queue moves the
+ * message of the highest priority blocked sender into the freed slot and wakes it.
+ *
+ * @param Add_structQueue      Pointer to the queue.
+ * @param Add_voidItem         Buffer receiving the message (`ItemSize` bytes).
+ * @param Copy_u32TicksToWait  Ticks to wait while the queue is empty, 0 to return at once or `OS_WAIT_FOREVER`.
+ * @return OS_tenuQueueState OS_QUEUE_OK, OS_QUEUE_EMPTY (no wait requested) or OS_QUEUE_TIMEOUT.
+ */
+OS_tenuQueueState OS_enumQueueReceive(OS_tstructQueue* Add_structQueue, void* Add_voidItem, u32 Copy_u32TicksToWait);
+
+/* Kernel side of the APIs, run in Handler Mode by OS_voidSvcServices */
+void OS_voidQueueSendService(OS_tstructQueue* Add_structQueue, const void* Add_voidItem, u32 Copy_u32TicksToWait);
+void OS_voidQueueReceiveService(OS_tstructQueue* Add_structQueue, void* Add_voidItem, u32 Copy_u32TicksToWait);
+
+#endif /* INC_QUEUE_H_ */
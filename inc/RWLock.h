@@ -0,0 +1,94 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Reader-writer locks for read-mostly shared data    */
+/****************************************************************/
+#ifndef INC_RWLOCK_H_
+#define INC_RWLOCK_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Fields of the lock word `State` */
+#define OS_RWLOCK_READERS           0x1FFFFFFFUL    // Number of readers holding the lock
+#define OS_RWLOCK_READERS_WAITING   0x20000000UL    // Set by the kernel while ReadWaitList may not be empty
+#define OS_RWLOCK_WRITER            0x40000000UL    // A writer holds the lock
+#define OS_RWLOCK_WRITERS_WAITING   0x80000000UL    // Set by the kernel while WriteWaitList may not be empty
+
+/* Reader-Writer Lock Structure
+ * Any number of readers or one writer hold the lock. Uncontended read lock / unlock are one
+ * LDREX / STREX on `State` in Thread Mode, the kernel is only entered to block or to hand the lock
+ * to waiters. With OS_RWLOCK_WRITER_PREFERENCE (MyRTOSConfig.h) new readers queue behind a waiting
+ * writer, otherwise they join the readers in place and writers wait until no reader is left. */
+typedef struct{
+	volatile u32 State;                     // Readers count, writer and waiting bits
+	OS_structTask* Writer;                  // Task holding the lock for writing
+	OS_structTask* ReadWaitList;            // Readers waiting, highest priority first (FIFO inside a priority)
+	OS_structTask* WriteWaitList;           // Writers waiting, highest priority first (FIFO inside a priority)
+}OS_tstructRWLock;
+
+typedef enum{
+	OS_RWLOCK_INIT_OK,
+	OS_RWLOCK_ACQUIRED,
+	OS_RWLOCK_BUSY,
+	OS_RWLOCK_TIMEOUT
+}OS_tenuRWLockState;
+
+/* APIs */
+/** OS_enumInitRWLock
+ * @brief Initializes a reader-writer lock, free and without waiters.
+ */
+OS_tenuRWLockState OS_enumInitRWLock(OS_tstructRWLock* Add_structLock);
+/** OS_enumRWLockRead
+ * @brief Takes the lock for reading, waiting at most a number of ticks.
+ *
+ * @param Add_structLock      Lock to take.
+ * @param Copy_u32TicksToWait Ticks to wait, 0 to return at once or `OS_WAIT_FOREVER`.
+ * @return OS_tenuRWLockState OS_RWLOCK_ACQUIRED, OS_RWLOCK_BUSY (no wait requested or called from
+ *         an interrupt handler) or OS_RWLOCK_TIMEOUT.
+ *
+ * @details
+ * The function performs the following steps:
+ * 1. Increments the readers count with LDREX / STREX if no writer holds the lock (and, with writer
+ *    preference, none is waiting).
+ * 2. Otherwise blocks the task on the read wait list through SVC_RWLOCK_READ. It is woken with
+ *    the other waiting readers when the lock goes to the readers.
+ *
+ * Example usage:
+ * @code
+ * OS_enumRWLockRead(&calibrationLock, OS_WAIT_FOREVER);
+ * gain = calibration[channel].gain;
+ * OS_voidRWLockReadUnlock(&calibrationLock);
+ * @endcode
+ */
+OS_tenuRWLockState OS_enumRWLockRead(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait);
+/** OS_voidRWLockReadUnlock
+ * @brief Releases a read lock: one LDREX / STREX, or SVC_RWLOCK_UNLOCK when the last reader leaves
+ *        while tasks are waiting.
+ */
+void OS_voidRWLockReadUnlock(OS_tstructRWLock* Add_structLock);
+/** OS_enumRWLockWrite
+ * @brief Takes the lock for writing, waiting at most a number of ticks.
+ *
+ * A free lock is taken with LDREX / STREX, otherwise the task blocks on the write wait list
+ * through SVC_RWLOCK_WRITE until the readers and the writer before it left.
+ *
+ * @param Add_structLock      Lock to take.
+ * @param Copy_u32TicksToWait Ticks to wait, 0 to return at once or `OS_WAIT_FOREVER`.
+ * @return OS_tenuRWLockState OS_RWLOCK_ACQUIRED, OS_RWLOCK_BUSY or OS_RWLOCK_TIMEOUT.
+ */
+OS_tenuRWLockState OS_enumRWLockWrite(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait);
+/** OS_voidRWLockWriteUnlock
+ * @brief Releases a write lock: one LDREX / STREX without waiters, else SVC_RWLOCK_UNLOCK hands
+ *        the lock to the next writer or to all the waiting readers.
+ */
+void OS_voidRWLockWriteUnlock(OS_tstructRWLock* Add_structLock);
+
+/* Kernel side, run in Handler Mode */
+OS_tenuRWLockState OS_enumRWLockReadService(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait);
+OS_tenuRWLockState OS_enumRWLockWriteService(OS_tstructRWLock* Add_structLock, u32 Copy_u32TicksToWait);
+void OS_voidRWLockUnlockService(OS_tstructRWLock* Add_structLock, u8 Copy_u8Writer);
+
+#endif /* INC_RWLOCK_H_ */
@@ -8,26 +8,10 @@
 
 #ifndef INC_SCHEDULER_H_
 #define INC_SCHEDULER_H_
-/** OS_voidSortSchedulerTable
- * @brief Sorts the scheduler table based on task priorities.
- *
- * This function sorts the tasks in the scheduler table in ascending order of their priorities
- * using the Bubble Sort algorithm. Tasks with lower priority values will be placed before tasks
- * with higher priority values.
- *
- * @details
- * The function performs the following steps:
- * 1. Iterates over the task table multiple times, comparing each task's priority with the next task's priority.
- * 2. Swaps tasks if the current task's priority is greater than the next task's priority.
- * 3. Repeats the process until the entire table is sorted.
- *
- * Example usage:
- * @code
- * OS_voidSortSchedulerTable();
- * // The scheduler table is now sorted based on task priorities.
- * @endcode
- */
-void OS_voidSortSchedulerTable();
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
 /** OS_voidUpdateReadyQueue
  * @brief Updates the ready queue for task scheduling.
  *
@@ -38,7 +22,7 @@ void OS_voidSortSchedulerTable();
  * @details
  * The function performs the following steps:
  * 1. Frees the ready queue by dequeuing all tasks until the queue is empty.
- * 2. Iterates over the task table to identify tasks that are not suspended.
+ * 2. Iterates over the list of created tasks to identify tasks that are not suspended.
  * 3. Enqueues tasks that are ready to be scheduled based on their priority.
  *    - Tasks with a lower priority value are enqueued first.
  *    - If two tasks have the same priority, they are both enqueued.
@@ -60,17 +44,16 @@ void OS_voidUpdateReadyQueue();
  *
  * @details
  * The function performs the following steps:
- * 1. Checks if the ready queue is empty and the current task is not suspended.
- *    - If both conditions are met, it continues running the current task:
- *      - Marks the current task as running.
- *      - Enqueues the current task back into the ready queue.
- *      - Sets the next task to the current task.
- * 2. If the ready queue is not empty or the current task is suspended:
- *    - Dequeues the next task from the ready queue.
+ * 1. Returns a task chosen by a previous decision, not yet switched to by PendSV, to its ready queue.
+ * 2. If no task is ready, keeps the current task while it is still running (idle task otherwise).
+ * 3. Keeps the current task if it is still running and has a higher priority than every ready task,
+ *    or if its preemption threshold (`PreemptionThreshold`, when above its priority) is not below
+ *    the highest ready priority: tasks up to the threshold, its own priority included (no round
+ *    robin), wait until it blocks, delays or ends.
+ * 4. Otherwise:
+ *    - Dequeues the next task from the highest priority ready queue and clears its bitmap bit once empty.
+ *    - Enqueues the current task back into its ready queue if it was preempted or shares the priority.
  *    - Marks the next task as running.
- *    - Checks if the next task has the same priority as the current task and the current task is not suspended:
- *      - Enqueues the current task back into the ready queue.
- *      - Marks the current task as ready.
  *
  * Example usage:
  * @code
@@ -79,6 +62,111 @@ void OS_voidUpdateReadyQueue();
  * @endcode
  */
 void OS_voidDecideNext();
+/** OS_MarkTaskReady
+ * @brief Enqueues a task in the ready queue of its priority and sets its bitmap bits.
+ */
+void OS_MarkTaskReady(OS_structTask* task);
+/** OS_voidReadyQueueRemove
+ * @brief Removes a task from the ready queue of its priority in O(1), used when a ready task is
+ *        terminated or deleted. Must be called from Handler Mode.
+ */
+void OS_voidReadyQueueRemove(OS_structTask* Add_structTask);
+/** OS_voidSchedule
+ * @brief Decides the next task and triggers PendSV if it differs from the current one.
+ *
+ * Used by kernel services running in Handler Mode after they changed the ready queues.
+ * Does nothing before `OS_enumStartOS` is called.
+ */
+void OS_voidSchedule();
+/** OS_u8ScheduleDeferred
+ * @brief Returns 1, and records the deferred decision, while the scheduler is locked by the
+ *        running task. Checked before every scheduling decision (services, SVC_ACTIVATE, SysTick).
+ */
+u8 OS_u8ScheduleDeferred();
+/** OS_voidSchedulerLock
+ * @brief Disables preemption of the running task, without masking interrupts. Calls may nest.
+ *
+ * Interrupts and kernel calls still run and make tasks ready, ticks are still counted and
+ * timeouts still expire, but the decision to switch task (`OS_voidDecideNext` and PendSV) waits
+ * for the last `OS_voidSchedulerUnlock`. Costs an increment, meant for short multi-step updates
+ * of data shared by tasks only. The task must not block, delay or terminate itself while it holds
+ * the lock. An interrupt handler may lock too if it unlocks before it returns.
+ *
+ * Example usage:
+ * @code
+ * OS_voidSchedulerLock();
+ * route.next = newNext;   // Seen by other tasks only once all the fields are written
+ * route.metric = newMetric;
+ * OS_voidSchedulerUnlock();
+ * @endcode
+ */
+void OS_voidSchedulerLock();
+/** OS_voidSchedulerUnlock
+ * @brief Ends one OS_voidSchedulerLock. The last one takes the deferred decision, if any
+ *        (one SVC, SVC_SCHEDULER_UNLOCK), the higher priority task made ready meanwhile then runs.
+ */
+void OS_voidSchedulerUnlock();
+/** OS_voidWaitListInsert
+ * @brief Inserts a task in a kernel object wait list ordered by priority.
+ *
+ * A wait list is a pointer to the first waiting task, tasks are linked through
+ * `Waiting.NextWaiter`. Higher priority tasks come first, equal priorities keep FIFO order.
+ *
+ * @param Add_structWaitList Pointer to the wait list head.
+ * @param Add_structTask     Task to insert.
+ */
+void OS_voidWaitListInsert(OS_structTask** Add_structWaitList, OS_structTask* Add_structTask);
+/** OS_structWaitListPop
+ * @brief Removes the highest priority task of a wait list.
+ *
+ * @param Add_structWaitList Pointer to the wait list head.
+ * @return OS_structTask* The removed task, or NULL if the list is empty.
+ */
+OS_structTask* OS_structWaitListPop(OS_structTask** Add_structWaitList);
+/** OS_voidWaitListRemove
+ * @brief Unlinks a task from the wait list it is blocked on, if any.
+ *
+ * @param Add_structTask Task to unlink.
+ */
+void OS_voidWaitListRemove(OS_structTask* Add_structTask);
+/** OS_voidBlockCurrentTask
+ * @brief Blocks the running task on a wait list and schedules another task.
+ *
+ * Must be called from Handler Mode. If `Copy_u32Ticks` is not `OS_WAIT_FOREVER` the task is
+ * woken by the tick handler after that many ticks with `Waiting.Result = OS_TASK_WAIT_TIMEOUT`.
+ *
+ * @param Add_structWaitList Wait list of the kernel object.
+ * @param Copy_u32Ticks      Maximum number of ticks to wait, or `OS_WAIT_FOREVER`.
+ */
+void OS_voidBlockCurrentTask(OS_structTask** Add_structWaitList, u32 Copy_u32Ticks);
+/** OS_voidTimeoutInsert
+ * @brief Inserts a task in the timeout list, it is woken when `Copy_u32Ticks` ticks elapsed.
+ *
+ * The timeout list is shared by delays and timed waits, sorted by wake tick. Must be called from
+ * Handler Mode with the task in no timing structure.
+ */
+void OS_voidTimeoutInsert(OS_structTask* Add_structTask, u32 Copy_u32Ticks);
+/** OS_voidTimeoutRemove
+ * @brief Unlinks a task from the timeout list in O(1), no effect if it is not there.
+ */
+void OS_voidTimeoutRemove(OS_structTask* Add_structTask);
+/** OS_voidWakeTask
+ * @brief Marks a task popped from a wait list ready with `Waiting.Result = OS_TASK_WAIT_OK`.
+ *
+ * Must be called from Handler Mode. The caller calls `OS_voidSchedule` when it is done.
+ *
+ * @param Add_structTask Task to wake.
+ */
+void OS_voidWakeTask(OS_structTask* Add_structTask);
+/** OS_voidWakeWaitListFromISR
+ * @brief Wakes the highest priority task of a wait list from an interrupt handler.
+ *
+ * Masks interrupts while kernel data is changed and triggers PendSV if the woken task
+ * must preempt the interrupted one.
+ *
+ * @param Add_structWaitList Wait list of the kernel object.
+ */
+void OS_voidWakeWaitListFromISR(OS_structTask** Add_structWaitList);
 /** OS_voidSvcServices
  * @brief Handles Supervisor Call (SVC) services in Handler Mode.
  *
@@ -88,14 +176,17 @@ void OS_voidDecideNext();
  *   to run, and triggers a PendSV interrupt if the operating system is in running mode.
  * - SVC_WAITING: Suspends a task. Updates scheduler and ready queues.
  * - SVC_SUSPEND: Placeholder case for future expansion or specific handling of task suspension.
+ * - SVC_TERMINATE: Removes a terminated (or delayed) task from its ready queue and reschedules.
+ * - SVC_CREATE / SVC_DELETE: Create or delete a task while the OS runs, the status is written
+ *   through the pointer passed in R1.
+ * - SVC_SPAWN: Takes a task and a stack from the kernel pools and makes the task ready.
  *
  * @param Add_u32StackFrame Pointer to the stack frame containing SVC parameters.
  *
  * @details
  * The function performs the following steps based on the SVC ID:
- * 1. Updates the scheduler table by sorting tasks based on priorities.
- * 2. Updates the ready queue with tasks ready to be scheduled.
- * 3. If the operating system is in running mode (`OS_RUNNING`):
+ * 1. Updates the ready queue with tasks ready to be scheduled.
+ * 2. If the operating system is in running mode (`OS_RUNNING`):
  *    - Decides the next task to run.
  *    - Triggers a PendSV interrupt to perform a context switch to the next task.
  *
@@ -112,25 +203,22 @@ void OS_voidDecideNext();
  */
 void OS_voidSvcServices(pu32 Add_u32StackFrame);
 /** OS_enumUpdateNoOfTicks
- * @brief Updates the tick count and handles task waiting based on blocking conditions.
+ * @brief Updates the tick count and wakes the tasks whose delay or timeout ended.
  *
- * This function iterates through the task table and decrements the tick count for tasks
- * that are in a blocking state. If a task's tick count reaches 1, it transitions the task
- * state to `OS_TASK_WAITING`, disables blocking, and requests a service to update the scheduler.
+ * Only the head of the timeout list is checked, a tick with no expiry costs O(1) whatever the
+ * number of tasks.
  *
  * @details
- * The function performs the following steps for each task in the task table:
- * 1. Checks if the task's blocking mode is enabled (`OS_TASK_BLOCKING_ENABLE`).
- * 2. Decrements the tick count (`TicksCount`) for tasks that are blocking.
- * 3. If the tick count reaches 1:
- *    - Sets the task state to `OS_TASK_WAITING`.
- *    - Disables blocking for the task.
- *    - Requests a service (SVC_WAITING) to update the scheduler table.
+ * The function performs the following steps:
+ * 1. Increments `OS_StructOS.TickCount`.
+ * 2. While the head of the timeout list (`OS_StructOS.TimeoutList`) has reached its wake tick:
+ *    - Unlinks it from the timeout list and from the wait list it is blocked on.
+ *    - Sets `Waiting.Result` to timeout and marks the task ready.
  *
  * Example usage:
  * @code
  * OS_enumUpdateNoOfTicks();
- * // Updates tick counts and handles task waiting based on blocking conditions.
+ * // Wakes the tasks whose delay or timeout ended.
  * @endcode
  */
 void OS_enumUpdateNoOfTicks();
@@ -0,0 +1,78 @@
+/**********************************************************/
+/* Author  : Mohamed Abdel Hamid                          */
+/* Date    : 7 / 6 / 2024                             	  */
+/* Version : V01                                          */
+/* Email   : mohamedhamiid20@gmail.com                    */
+/* Brief   : Handling semaphores for tasks synchronization*/
+/**********************************************************/
+#ifndef INC_SEMAPHORE_H_
+#define INC_SEMAPHORE_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Bit of `s` set by the kernel while tasks may be in WaitList: releases then go through the kernel */
+#define OS_SEMAPHORE_WAITERS      0x80000000UL
+
+// Semaphore Structure
+// A binary semaphore (1 resource) is the kernel mutex: the owner is recorded and tasks block on it.
+// Uncontended acquire / release update `s` with LDREX / STREX in Thread Mode, without SVC.
+typedef struct{
+	volatile u32 s;                         // Available resources (bits 0 to 30) and OS_SEMAPHORE_WAITERS
+	OS_structTask* currentOwner;            // Task holding the semaphore
+	OS_structTask* WaitList;                // Tasks waiting, highest priority first (FIFO inside a priority)
+}OS_tstructSemaphore;
+
+typedef enum{
+	OS_SEMAPHORE_INIT_OK,
+	OS_SEMAPHORE_AVAILABLE,
+	OS_SEMAPHORE_BUSY,
+	OS_SEMAPHORE_ALREADY_ACQUIRED,
+	OS_SEMAPHORE_TIMEOUT
+}OS_tenuSemaphoreState;
+
+/* APIs */
+/** OS_enumInitSemaphore
+ * @brief Initializes a semaphore structure with initial values.
+ *
+ * @param Add_structSemaphore Pointer to the semaphore structure to initialize.
+ * @param Copy_u8NoOfAvailable Number of available resources for the semaphore (1 for a binary semaphore).
+ * @return OS_tenuSemaphoreState Returns OS_SEMAPHORE_INIT_OK indicating successful initialization.
+ */
+OS_tenuSemaphoreState OS_enumInitSemaphore(OS_tstructSemaphore* Add_structSemaphore, u8 Copy_u8NoOfAvailable);
+/** OS_enumAcquireSemaphore
+ * @brief Attempts to acquire a semaphore for the running task, waiting at most a number of ticks.
+ *
+ * An available resource is taken with LDREX / STREX, only a task that must wait enters the kernel
+ * (SVC_SEMAPHORE_ACQUIRE). The wait uses the timeout list shared with OS_enumDelayTask. From an
+ * interrupt handler the semaphore is only taken if available (no owner is recorded).
+ *
+ * @param Add_structSemaphore Pointer to the semaphore structure to acquire.
+ * @param Copy_u32TicksToWait Ticks to wait, 0 to return at once or `OS_WAIT_FOREVER`.
+ * @return OS_tenuSemaphoreState OS_SEMAPHORE_AVAILABLE, OS_SEMAPHORE_ALREADY_ACQUIRED,
+ *         OS_SEMAPHORE_BUSY (no wait requested) or OS_SEMAPHORE_TIMEOUT.
+ *
+ * Example usage:
+ * @code
+ * if(OS_enumAcquireSemaphore(&bus, 10) == OS_SEMAPHORE_TIMEOUT){
+ *     // Bus stuck for 10 ticks, kick the watchdog and try again
+ * }
+ * @endcode
+ */
+OS_tenuSemaphoreState OS_enumAcquireSemaphore(OS_tstructSemaphore* Add_structSemaphore, u32 Copy_u32TicksToWait);
+/** OS_enumReleaseSemaphore
+ * @brief Releases a semaphore, handing it to the highest priority waiting task.
+ *
+ * Without waiting tasks the count is incremented with LDREX / STREX, the kernel is only entered
+ * when OS_SEMAPHORE_WAITERS is set. May be called from tasks and interrupt handlers.
+ *
+ * @param Add_structSemaphore Pointer to the semaphore structure to release.
+ * @return OS_tenuSemaphoreState OS_SEMAPHORE_AVAILABLE if a waiting task got it, OS_SEMAPHORE_BUSY otherwise.
+ */
+OS_tenuSemaphoreState OS_enumReleaseSemaphore(OS_tstructSemaphore* Add_structSemaphore);
+
+/* Kernel side, run in Handler Mode */
+OS_tenuSemaphoreState OS_enumAcquireSemaphoreService(OS_tstructSemaphore* Add_structSemaphore, u32 Copy_u32TicksToWait);
+OS_tenuSemaphoreState OS_enumReleaseSemaphoreService(OS_tstructSemaphore* Add_structSemaphore);
+
+#endif /* INC_SEMAPHORE_H_ */
@@ -0,0 +1,108 @@
+/****************************************************************/
+/* Author  : Mohamed Abdel Hamid                                */
+/* Date    : 19 / 10 / 2026                                     */
+/* Version : V01                                                */
+/* Email   : mohamedhamiid20@gmail.com                          */
+/* Brief   : Lock-free byte stream from one producer (usually   */
+/*           an ISR) to one consumer task                       */
+/****************************************************************/
+#ifndef INC_STREAMBUFFER_H_
+#define INC_STREAMBUFFER_H_
+
+#include "STD_TYPES.h"
+#include "Task.h"
+
+/* Stream Buffer Structure
+ * Single producer / single consumer: the producer only writes WriteIndex and the
+ * consumer only writes ReadIndex, both are free running so no shared counter and no
+ * critical section is needed to move bytes. */
+typedef struct{
+	u8*  Buffer;                         // Storage given by the user
+	u32  Mask;                           // Size - 1, the size is a power of two
+	u32  TriggerLevel;                   // Bytes needed before a blocked reader is woken
+	volatile u32 WriteIndex;             // Free running, written by the producer only
+	volatile u32 ReadIndex;              // Free running, written by the consumer only
+	OS_structTask* volatile ReaderWaitList; // Reader blocked until TriggerLevel bytes are available
+}OS_tstructStreamBuffer;
+
+typedef enum{
+	OS_STREAM_INIT_OK,
+	OS_STREAM_INIT_ERROR
+}OS_tenuStreamState;
+
+/* APIs */
+/** OS_enumStreamBufferCreate
+ * @brief Initializes a stream buffer over a user provided byte array.
+ *
+ * @param Add_structStream     Pointer to the stream buffer structure to initialize.
+ * @param Add_u8Buffer         Storage of `Copy_u32Size` bytes.
+ * @param Copy_u32Size         Size of the storage, must be a power of two.
+ * @param Copy_u32TriggerLevel Number of bytes that must be available before a blocked reader
+ *                             is woken (1 wakes it on every commit), at most `Copy_u32Size`.
+ * @return OS_tenuStreamState OS_STREAM_INIT_OK, or OS_STREAM_INIT_ERROR for invalid parameters.
+ *
+ * Example usage:
+ * @code
+ * OS_tstructStreamBuffer uartRx;
+ * u8 uartRxBuffer[256];
+ * OS_enumStreamBufferCreate(&uartRx, uartRxBuffer, 256, 16);
+ * @endcode
+ */
+OS_tenuStreamState OS_enumStreamBufferCreate(OS_tstructStreamBuffer* Add_structStream, u8* Add_u8Buffer, u32 Copy_u32Size, u32 Copy_u32TriggerLevel);
+
+/* Producer side (ISR or one task) */
+/** OS_u32StreamBufferAcquireWrite
+ * @brief Gives the producer direct access to the free space of the buffer (zero-copy).
+ *
+ * @param Add_structStream Pointer to the stream buffer.
+ * @param Add_pu8Span      Receives the address of the first free byte.
+ * @return u32 Number of contiguous free bytes at that address (0 if the buffer is full).
+ */
+u32  OS_u32StreamBufferAcquireWrite(OS_tstructStreamBuffer* Add_structStream, u8** Add_pu8Span);
+/** OS_voidStreamBufferCommit
+ * @brief Publishes bytes written in a span returned by OS_u32StreamBufferAcquireWrite.
+ *
+ * Wakes the blocked reader once the trigger level is reached, directly when called from
+ * an ISR or through SVC_STREAM_NOTIFY when called from a task.
+ *
+ * @param Add_structStream Pointer to the stream buffer.
+ * @param Copy_u32Length   Number of bytes written, at most the acquired span length.
+ */
+void OS_voidStreamBufferCommit(OS_tstructStreamBuffer* Add_structStream, u32 Copy_u32Length);
+/** OS_u32StreamBufferSend
+ * @brief Copies bytes into the buffer and commits them.
+ *
+ * @return u32 Number of bytes copied (limited by the free space, never blocks).
+ */
+u32  OS_u32StreamBufferSend(OS_tstructStreamBuffer* Add_structStream, const void* Add_voidData, u32 Copy_u32Length);
+
+/* Consumer side (one task) */
+/** OS_u32StreamBufferAcquireRead
+ * @brief Gives the consumer direct access to the available bytes (zero-copy).
+ *
+ * Blocks while fewer than `TriggerLevel` bytes are available, then returns every available
+ * contiguous byte. On timeout the bytes already available (possibly fewer than the trigger
+ * level) are returned.
+ *
+ * @param Add_structStream     Pointer to the stream buffer.
+ * @param Add_pu8Span          Receives the address of the first available byte.
+ * @param Copy_u32TicksToWait  Ticks to wait for the trigger level, 0 to return at once or `OS_WAIT_FOREVER`.
+ * @return u32 Number of contiguous bytes at that address (0 if none).
+ */
+u32  OS_u32StreamBufferAcquireRead(OS_tstructStreamBuffer* Add_structStream, const u8** Add_pu8Span, u32 Copy_u32TicksToWait);
+/** OS_voidStreamBufferRelease
+ * @brief Gives back bytes consumed from a span returned by OS_u32StreamBufferAcquireRead.
+ */
+void OS_voidStreamBufferRelease(OS_tstructStreamBuffer* Add_structStream, u32 Copy_u32Length);
+/** OS_u32StreamBufferReceive
+ * @brief Copies up to `Copy_u32MaxLength` bytes out of the buffer, blocking like OS_u32StreamBufferAcquireRead.
+ *
+ * @return u32 Number of bytes copied (0 on timeout).
+ */
+u32  OS_u32StreamBufferReceive(OS_tstructStreamBuffer* Add_structStream, void* Add_voidData, u32 Copy_u32MaxLength, u32 Copy_u32TicksToWait);
+
+/* Kernel side of the APIs, run in Handler Mode by OS_voidSvcServices */
+void OS_voidStreamBufferWaitService(OS_tstructStreamBuffer* Add_structStream, u32 Copy_u32TicksToWait);
+void OS_voidStreamBufferNotifyService(OS_tstructStreamBuffer* Add_structStream);
+
+#endif /* INC_STREAMBUFFER_H_ */
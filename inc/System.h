@@ -8,9 +8,10 @@
 #ifndef INC_SYSTEM_H_
 #define INC_SYSTEM_H_
 
+#include <stdint.h>
 #include "STD_TYPES.h"
 #include "Task.h"
-#include "System.h"
+#include "MyRTOSConfig.h"
 
 // Macro: OS_STACK_PADDING
 // Description: Defines the padding size (in bytes) used between the end of one stack allocation
@@ -24,45 +25,104 @@
 //              allowing the operating system to handle the requested service.
 #define OS_REQUEST_SERVICE(SVC_ID)  __asm volatile ("SVC %[SVCid]" : : [SVCid] "i" (SVC_ID));
 
+// Macro: OS_REQUEST_SERVICE_ARGS(SVC_ID, ARG0, ARG1, ARG2)
+// Description: Same as OS_REQUEST_SERVICE but pins three arguments in R0, R1 and R2 before the
+//              SVC instruction, so OS_voidSvcServices can read them back from the stacked frame.
+#define OS_REQUEST_SERVICE_ARGS(SVC_ID, ARG0, ARG1, ARG2)                                   \
+	__asm volatile ("MOV R0, %[Arg0] \n\t MOV R1, %[Arg1] \n\t MOV R2, %[Arg2] \n\t SVC %[SVCid]" \
+	                : : [SVCid] "i" (SVC_ID), [Arg0] "r" (ARG0), [Arg1] "r" (ARG1), [Arg2] "r" (ARG2) \
+	                : "r0", "r1", "r2", "memory");
+
+/**
+ * @brief Define values for multi-level queue and bit map
+ */
+#define OS_TASKS_NO_OF_CLUSTERS  					8
+#define OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER       (OS_TASK_PRIORITY_LEVELS / OS_TASKS_NO_OF_CLUSTERS)
+
 /**
  * @brief Structure defining the operating system (OS) attributes.
+ * NOTE: CurrentTask and NextTask must stay the first two members, PendSV_Handler
+ *       accesses them by offset.
  */
-extern struct{
-	u8  NoOfCreatedTasks;
-	u32 _S_MSP_Task ;               // Start of main(OS) stack
-	u32 _E_MSP_Task ; 	            // End   of main(OS) stack
-	u32 PSP_LastEnd ;               // End of Last PSP allocated
-	enum{
-		OS_SUSPEND,
-		OS_RUNNING
-	}OS_enumMode;
-	OS_structTask* CurrentTask;
-	OS_structTask* NextTask;
-	OS_structTask* TaskTable[100] ; // Table of all tasks of System
-
-}OS_StructOS;
+typedef struct {
+    OS_structTask* CurrentTask;         // Pointer to the currently running task
+    OS_structTask* NextTask;            // Pointer to the next task to be scheduled
+
+	uint8_t isOsIsrRunning;
+	uint8_t isIsrDisabled;
+	uint8_t isIsrSuspended;
+	uint8_t isOsIsrSuspended;
+	uint8_t initialPriorityValue;
+	uint8_t interruptId;
+	uint8_t highestOsIsrPriority;
+
+    u32 NoOfCreatedTasks;               // Number of tasks created in the system
+    u32 _S_MSP_Task;                    // Start of main (OS) stack pointer
+    u32 _E_MSP_Task;                    // End of main (OS) stack pointer
+    u32 PSP_LastEnd;                    // End of the last allocated Process Stack Pointer (PSP)
+    u32 PSP_Limit;                      // Lowest address task stacks may use
+    volatile u32 TickCount;             // Ticks since the OS started, wraps around
+    OS_structTask* TimeoutList;         // Delayed tasks and timed waits, sorted by wake tick
+    volatile u32 SchedulerLock;         // Nesting of OS_voidSchedulerLock, decisions are deferred while not 0
+    volatile u8 ScheduleDeferred;       // A decision was deferred by the lock, taken at the last unlock
+
+    enum {
+        OS_SUSPEND,                     // Operating system in suspend mode
+        OS_RUNNING                      // Operating system in running mode
+    } OS_enumMode;                      // Current mode of the operating system
+
+
+    OS_structTask* TaskList;            // First created task, tasks are linked through AllTasks
+    OS_structTask* DeletedTask;         // Task that deleted itself, reclaimed once switched out
+
+    uint32_t bitMap0;
+    uint8_t bitMap1[OS_TASKS_NO_OF_PRIORITIES_PER_CLUSTER];
+//    ISR_tstructICB* OsIsrTable[100]; 	// Table of all CAT2 ISRs of System
+} OS_tstructOS;
+
+extern OS_tstructOS OS_StructOS;
 
 /**
  * @brief Enumeration defining the Service Call (SVC) IDs for the operating system.
  */
-extern enum{
-	SVC_ACTIVATE      ,
-	SVC_TERMINATE     ,
-	SVC_WAITING       ,
-	SVC_SUSPEND       ,
-	SVC_ACQUIRE_MUTEX ,
-	SVC_RELEASE_MUTEX
-}OS_enumSvcID;
+typedef enum {
+	SVC_GET_ISR_ID = 1,      // SVC ID for Getting ISR ID (Autosar Compliant)
+    SVC_ACTIVATE,        // SVC ID for activating a task
+    SVC_TERMINATE,       // SVC ID for terminating a task
+    SVC_WAITING,         // SVC ID for task waiting
+    SVC_SUSPEND,         // SVC ID for suspending a task
+    SVC_QUEUE_SEND,      // SVC ID for sending to a message queue
+    SVC_QUEUE_RECEIVE,   // SVC ID for receiving from a message queue
+    SVC_STREAM_WAIT,     // SVC ID for waiting on a stream buffer trigger level
+    SVC_STREAM_NOTIFY,   // SVC ID for waking a stream buffer reader from a task
+    SVC_PINGPONG_WAIT,   // SVC ID for waiting on a filled DMA buffer
+    SVC_POOL_ALLOC,      // SVC ID for allocating a memory pool block
+    SVC_POOL_FREE,       // SVC ID for freeing a memory pool block
+    SVC_HEAP_ALLOC,      // SVC ID for allocating from the heap
+    SVC_HEAP_FREE,       // SVC ID for freeing to the heap
+    SVC_HEAP_STATS,      // SVC ID for reading the heap statistics
+    SVC_CREATE,          // SVC ID for creating a task while the OS runs
+    SVC_DELETE,          // SVC ID for deleting a task
+    SVC_SPAWN,           // SVC ID for spawning a task from the task pool
+    SVC_DELAY,           // SVC ID for delaying a task
+    SVC_SEMAPHORE_ACQUIRE,// SVC ID for taking a semaphore
+    SVC_SEMAPHORE_RELEASE,// SVC ID for giving a semaphore back
+    SVC_EVENT_WAIT,      // SVC ID for waiting on event group bits
+    SVC_EVENT_SET,       // SVC ID for setting event group bits and waking the satisfied waiters
+    SVC_COROUTINE_WAIT,  // SVC ID for blocking a coroutine host with no ready coroutine
+    SVC_COROUTINE_SIGNAL,// SVC ID for giving a coroutine signal from a task
+    SVC_RWLOCK_READ,     // SVC ID for waiting on a reader-writer lock to read
+    SVC_RWLOCK_WRITE,    // SVC ID for waiting on a reader-writer lock to write
+    SVC_RWLOCK_UNLOCK,   // SVC ID for handing a reader-writer lock to its waiters
+    SVC_CONDVAR_WAIT,    // SVC ID for releasing a mutex and waiting on a condition variable
+    SVC_CONDVAR_SIGNAL,  // SVC ID for moving condition variable waiters to their mutex
+    SVC_BARRIER_WAIT,    // SVC ID for arriving at a barrier
+    SVC_ACTIVATE_BATCH,  // SVC ID for activating several tasks with one scheduling decision
+    SVC_SCHEDULER_UNLOCK,// SVC ID for taking the decision deferred by the scheduler lock
+    SVC_SET_PRIORITY,    // SVC ID for changing the priority of a task
+} OS_tenuSvcID;
 
 void OS_enumUpdateNoOfTicks();
 
 
-
-
-
-
-
-
-
-
 #endif /* INC_SYSTEM_H_ */
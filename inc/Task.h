@@ -9,6 +9,7 @@
 #define INC_TASK_H_
 
 #include "STD_TYPES.h"
+#include "MyRTOSConfig.h"
 
 typedef enum {
 	noAutoStart,
@@ -17,10 +18,25 @@ typedef enum {
 
 
 
+/* MPU regions reprogrammed on every context switch: the stack guard and two data regions */
+#define OS_MPU_TASK_REGIONS        3
+
+/* Ticks value to block on a kernel object without timeout */
+#define OS_WAIT_FOREVER            0xFFFFFFFF
+
 // Task Structure
-typedef struct{
+typedef struct OS_structTaskTag{
+	/* Keep first: PendSV_Handler reads CurrentPSP at offset 0, _E_PSP_Task at offset 4
+	 * and MpuRegions at offset 12 */
+	pu32 CurrentPSP ;
+	u32 _E_PSP_Task ; // End   of task stack (lowest address, holds the stack canary)
+	u32 _S_PSP_Task ; // Start of task stack
+#if OS_MPU_ENABLE == 1
+	u32 MpuRegions[2 * OS_MPU_TASK_REGIONS]; // RBAR / RASR pairs, written to the MPU as they are
+#endif
 	/* Entered by user */
 	u8 Priority;
+	u8 PreemptionThreshold;        // While running, only tasks above it preempt (0 or <= Priority: Priority)
 	u8 TaskName[30] ;
 	u16 StackSize;
 	void (*func)(void); // Pointer to C function of the task
@@ -30,12 +46,27 @@ typedef struct{
 		enum{
 			OS_TASK_BLOCKING_DISABLE,
 			OS_TASK_BLOCKING_ENABLE
-		}Blocking;
-		u32 TicksCount;
+		}Blocking;                             // Enabled while the task is in the timeout list
+		u32 WakeTick;                          // Value of OS_StructOS.TickCount the delay / timeout ends at
+		enum{
+			OS_TASK_WAIT_OK,
+			OS_TASK_WAIT_TIMEOUT
+		}Result;                               // Why the task left its last wait
+		void* Data;                            // Item sent, buffer to receive in or wait request while blocked
+		struct OS_structTaskTag*  NextWaiter;  // Next task in the same wait list
+		struct OS_structTaskTag** WaitLink;    // Link pointing to the task in its wait list (NULL if none)
+		struct OS_structTaskTag** WaitHead;    // Head of that wait list, to insert the task again by priority
+		struct OS_structTaskTag*  NextTimeout; // Timeout list, sorted by WakeTick
+		struct OS_structTaskTag*  PrevTimeout;
 	}Waiting;
-	u32 _S_PSP_Task ; // Start of task stack
-	u32 _E_PSP_Task ; // End   of task stack
-	pu32 CurrentPSP ;
+	struct{
+		struct OS_structTaskTag* Next;         // Next created task (next free task while in the task pool)
+		struct OS_structTaskTag* Prev;         // Previous created task (NULL for the first one)
+	}AllTasks;
+	struct{
+		struct OS_structTaskTag* Next;         // Next task in the ready queue of its priority
+		struct OS_structTaskTag* Prev;         // Previous one (NULL for the head), removal in O(1)
+	}Ready;
 	enum{
 		OS_TASK_SUSPEND,
 		OS_TASK_WAITING,
@@ -44,14 +75,31 @@ typedef struct{
 	}TaskState;
 }OS_structTask;
 
+/* Ready queue of one priority: FIFO of the ready tasks linked through Ready.Next / Ready.Prev, so
+ * it holds every task of the priority without a size limit and any task leaves it in O(1) */
+typedef struct{
+	OS_structTask* Head;
+	OS_structTask* Tail;
+}OS_tstructReadyQueue;
+
 typedef enum {
 	OS_OK  ,
 	OS_EXCEED_AVAILABLE_STACK,
 	FIFO_INIT_ERROR,
-	TASK_CREATION_ERROR
+	TASK_CREATION_ERROR,
+	HEAP_INIT_ERROR
 
 }OS_enumErrorStatus;
 
+/* Arguments of SVC_SPAWN, they do not fit the three SVC argument registers */
+typedef struct{
+	void (*func)(void);
+	u8 Priority;
+	u8 StackClass;
+	OS_structTask* Task;           // Spawned task (output)
+	OS_enumErrorStatus Status;     // Result of the service (output)
+}OS_tstructSpawnRequest;
+
 
 /* APIs */
 /**
@@ -61,9 +109,14 @@ typedef enum {
  * 1. Initializes hardware using `OS_voidHwInit`.
  * 2. Sets the operating system mode to suspended (`OS_SUSPEND`).
  * 3. Creates the main stack using `OS_enumCreateMainStack`.
- * 4. Initializes the ready queue (`Global_structReadyQueue`) with a capacity of 100.
- * 5. Initializes the idle task (`Global_structIdleTask`) with the lowest priority,
+ * 4. Adds the default heap region (`OS_HEAP_SIZE` bytes) using `OS_enumHeapInit`.
+ * 5. Initializes one empty ready queue (`Global_structReadyQueue`) per priority level, tasks are
+ *    linked in it through `Ready.Next` / `Ready.Prev` so it never fills up.
+ * 6. Initializes the idle task (`Global_structIdleTask`) with the lowest priority,
  *    a task name "IDLE", a stack size of 300, and creates it using `OS_enumCreateTask`.
+ * 7. Links the task pool (`OS_TASK_POOL_SIZE` entries) and cuts the stack pool with `OS_enumStackPoolInit`.
+ * 8. Enables the dispatcher interrupt of the basic tasks with `OS_voidBasicTaskInit` (only with
+ *    `OS_BASIC_TASK_ENABLE` set to 1).
  *
  * @return OS_enumErrorStatus Returns OS_OK if initialization is successful, or an error code
  *         indicating specific initialization failure otherwise.
@@ -84,19 +137,24 @@ OS_enumErrorStatus OS_enumInit();
  * @brief Creates a new task and initializes its stack and state.
  *
  * This function creates a new task by allocating and configuring its stack,
- * adding it to the scheduler table (TaskTable), and updating its state to suspended.
+ * adding it to the list of created tasks, and updating its state to suspended.
+ * Once the OS runs, a task creates other tasks through SVC_CREATE.
  *
  * @param Add_structTask Pointer to the task structure to create and initialize.
- * @return OS_enumErrorStatus Returns OS_OK indicating successful task creation.
+ * @return OS_enumErrorStatus Returns OS_OK indicating successful task creation,
+ *         OS_EXCEED_AVAILABLE_STACK if no stack is available or TASK_CREATION_ERROR if the
+ *         task is already created.
  *
  * @details
- * The function performs the following steps to create a task:
- * 1. Allocates stack space for the task and checks it does not exceed the PSP stack limit.
- * 2. Aligns the stack space with an 8-byte padding to ensure proper memory alignment.
+ * The function performs the following steps to create a task (OS_enumCreateTaskService):
+ * 1. Checks the task is not already created (or deleted but not reclaimed yet).
+ * 2. Allocates a stack of the task's size class using `OS_enumStackAlloc`, reusing the stack of a
+ *    deleted task when possible and checking the process stack region limit otherwise.
  * 3. Creates the stack using `OS_enumCreateStack`.
- * 4. Adds the task to the scheduler table (`TaskTable`) of the operating system.
- * 5. Increments the count of created tasks (`NoOfCreatedTasks`).
- * 6. Sets the initial state of the task to suspended (`TaskState = OS_TASK_SUSPEND`).
+ * 4. Clears the waiting information left by a previous use of the task structure.
+ * 5. Links the task at the head of the list of created tasks (`TaskList`) in O(1).
+ * 6. Increments the count of created tasks (`NoOfCreatedTasks`).
+ * 7. Sets the initial state of the task to suspended (`TaskState = OS_TASK_SUSPEND`).
  *
  * Example usage:
  * @code
@@ -112,20 +170,91 @@ OS_enumErrorStatus OS_enumInit();
  * @endcode
  */
 OS_enumErrorStatus OS_enumCreateTask(OS_structTask* Add_structTask);
+/** OS_enumDeleteTask
+ * @brief Deletes a task and reclaims its stack.
+ *
+ * The task is removed from every kernel list, its stack is given back to the stack allocator
+ * and it is unlinked from the list of created tasks in O(1), so the task structure itself can be
+ * given to OS_enumCreateTask again (tasks of the task pool go back to the pool). A task may delete
+ * itself, it never runs again.
+ *
+ * @param Add_structTask Pointer to the task to delete.
+ * @return OS_enumErrorStatus OS_OK, or TASK_CREATION_ERROR if the task is the idle task or was
+ *         not created.
+ *
+ * @details
+ * The function performs the following steps (OS_enumDeleteTaskService):
+ * 1. Reclaims a task that deleted itself before, then refuses the idle task and tasks that are
+ *    not created.
+ * 2. Removes the task from its ready queue, from the timeout list and from the kernel object wait
+ *    list it is blocked on, all in O(1).
+ * 3. Unlinks the task from the list of created tasks.
+ * 4. Frees its stack with `OS_voidStackFree` and gives pool tasks back to the task pool. A task
+ *    deleting itself keeps both until the context switch saved its registers on them, it is kept
+ *    in `DeletedTask` and reclaimed by the next create, spawn or delete.
+ * 5. Reschedules, so a task deleting itself is switched out at once.
+ *
+ * NOTE: Semaphores held by the task are not released.
+ *
+ * Example usage:
+ * @code
+ * void connectionHandler(){
+ *     // Serve the connection
+ *     OS_enumDeleteTask(OS_StructOS.CurrentTask);
+ * }
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumDeleteTask(OS_structTask* Add_structTask);
+/** OS_enumSpawnTask
+ * @brief Creates and activates a task using a task structure and a stack owned by the kernel.
+ *
+ * Task structures come from a static pool of `OS_TASK_POOL_SIZE` entries and stacks from the
+ * stack pool free list of the requested size class, filled at init with `OS_STACK_POOL_BLOCKS`,
+ * so a spawn takes both in O(1) without searching any table and without using the heap. Created
+ * tasks never take pool stacks, and deleting a spawned task gives both back to the pools.
+ *
+ * @param func              Function of the task.
+ * @param Copy_u8Priority   Priority of the task (below `OS_TASK_PRIORITY_LEVELS`).
+ * @param Copy_u8StackClass Stack size class, the stack is 2^(OS_STACK_MIN_CLASS_LOG2 + class) bytes.
+ * @param Add_pstructTask   Receives the spawned task, may be NULL.
+ * @return OS_enumErrorStatus OS_OK, TASK_CREATION_ERROR if the task pool is empty or an argument
+ *         is out of range, or OS_EXCEED_AVAILABLE_STACK if no stack of the class is left.
+ *
+ * @details
+ * The function performs the following steps (OS_voidSpawnTaskService):
+ * 1. Reclaims a task that deleted itself before.
+ * 2. Pops a task structure from the task pool free list.
+ * 3. Fills it, takes a stack of the class from the stack pool with `OS_enumStackPoolAlloc` and
+ *    creates it (stack frame, list of created tasks) like `OS_enumCreateTask`.
+ * 4. Marks it ready and reschedules, a spawned task with a higher priority runs at once.
+ *
+ * Example usage:
+ * @code
+ * void requestHandler(){
+ *     // Serve the request
+ *     OS_enumDeleteTask(OS_StructOS.CurrentTask);
+ * }
+ * // From a task or an interrupt handler
+ * if(OS_enumSpawnTask(requestHandler, 2, 1, NULL) != OS_OK)
+ *     // Drop the request
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumSpawnTask(void (*func)(void), u8 Copy_u8Priority, u8 Copy_u8StackClass, OS_structTask** Add_pstructTask);
 /** OS_enumActivateTask
- * @brief Activates a suspended task, changing its state to waiting.
+ * @brief Activates a suspended, delayed or blocked task, making it ready.
  *
- * This function activates a suspended task by changing its state from suspended
- * (`OS_TASK_SUSPEND`) to waiting (`OS_TASK_WAITING`). It then requests activation
- * of the task via a service call to the operating system.
+ * This function requests activation of the task via a service call to the operating
+ * system. A task blocked on a kernel object leaves its wait list and its wait returns
+ * a timeout. A task already ready or running is left as it is.
  *
  * @param Add_structTask Pointer to the task structure to activate.
  * @return OS_enumErrorStatus Returns OS_OK indicating successful task activation.
  *
  * @details
  * The function performs the following steps to activate a task:
- * 1. Changes the state of the task from suspended to waiting (`TaskState = OS_TASK_WAITING`).
- * 2. Requests activation of the task by calling `OS_REQUEST_SERVICE(SVC_ACTIVATE)`.
+ * 1. Requests activation of the task through `SVC_ACTIVATE`, which skips a ready or running task.
+ * 2. Removes the task from the timeout list and from the wait list it is blocked on, in O(1).
+ * 3. Marks it ready and decides the next task, triggering PendSV if it preempts the caller.
  *
  * Example usage:
  * @code
@@ -142,59 +271,92 @@ OS_enumErrorStatus OS_enumCreateTask(OS_structTask* Add_structTask);
  * if(loc_enumERROR != OS_OK)
  * 		while(1);
  *
- * // Activates 'myTask' by changing its state to waiting and requesting activation via SVC.
+ * // Activates 't1' by requesting activation via SVC.
  * @endcode
  */
 OS_enumErrorStatus OS_enumActivateTask(OS_structTask* Add_structTask);
+/** OS_enumActivateTasks
+ * @brief Activates several tasks in one kernel entry (SVC_ACTIVATE_BATCH) with one scheduling decision.
+ *
+ * Costs one SVC and at most one PendSV for the whole batch, where activating the tasks one by one
+ * costs one of each per task. Tasks already ready or running are skipped, blocked tasks leave
+ * their wait list and their wait returns a timeout. May be called from interrupt handlers.
+ *
+ * @param Add_structTasks   Array of the tasks to activate.
+ * @param Copy_u32NoOfTasks Number of tasks in the array.
+ * @return OS_enumErrorStatus Returns OS_OK.
+ *
+ * Example usage:
+ * @code
+ * OS_structTask* workers[] = { &w1, &w2, &w3, &w4, &w5, &w6 };
+ * OS_enumActivateTasks(workers, 6); // Frame dispatcher
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumActivateTasks(OS_structTask** Add_structTasks, u32 Copy_u32NoOfTasks);
 /** OS_enumTerminateTask
  * @brief Terminates a task by changing its state to suspended.
  *
- * This function terminates a task by changing its state from any state to suspended
- * (`OS_TASK_SUSPEND`). It then requests termination of the task via a service call
- * to the operating system.
+ * This function requests termination of the task via a service call to the operating
+ * system, which changes its state from any state to suspended (`OS_TASK_SUSPEND`).
  *
  * @param Add_structTask Pointer to the task structure to terminate.
  * @return OS_enumErrorStatus Returns OS_OK indicating successful task termination.
  *
  * @details
  * The function performs the following steps to terminate a task:
- * 1. Changes the state of the task to suspended (`TaskState = OS_TASK_SUSPEND`).
- * 2. Requests termination of the task by calling `OS_REQUEST_SERVICE(SVC_TERMINATE)`.
+ * 1. Requests termination of the task through `SVC_TERMINATE`.
+ * 2. In the kernel: removes it from its ready queue, the timeout list and its wait list, and
+ *    changes its state to suspended (`TaskState = OS_TASK_SUSPEND`) in the same critical section.
+ * 3. Reschedules (a task terminating itself is switched out at once).
  *
  * Example usage:
  * @code
  * OS_structTask myTask;
  * OS_enumTerminateTask(&myTask);
- * // Terminates 'myTask' by changing its state to suspended and requesting termination via SVC.
+ * // Terminates 'myTask' by requesting termination via SVC.
  * @endcode
  */
 OS_enumErrorStatus OS_enumTerminateTask(OS_structTask* Add_structTask);
 /** OS_enumDelayTask
- * @brief Initializes the operating system.
+ * @brief Delays a task for a number of ticks.
  *
- * This function initializes the operating system by performing the following steps:
- * 1. Initializes hardware using `OS_voidHwInit`.
- * 2. Sets the operating system mode to suspended (`OS_SUSPEND`).
- * 3. Creates the main stack using `OS_enumCreateMainStack`.
- * 4. Initializes the ready queue (`Global_structReadyQueue`) with a capacity of 100.
- * 5. Initializes the idle task (`Global_structIdleTask`) with the lowest priority,
- *    a task name "IDLE", a stack size of 300, and creates it using `OS_enumCreateTask`.
+ * The task leaves the ready queues and waits in the timeout list shared with the timed waits on
+ * kernel objects, a task is in that list at most once.
  *
- * @return OS_enumErrorStatus Returns OS_OK if initialization is successful, or an error code
- *         indicating specific initialization failure otherwise.
+ * @param Add_structTask Pointer to the task structure to delay.
+ * @param Copy_u32NoOfTicks Number of ticks to delay the task (0 waits for the next tick).
+ * @return OS_enumErrorStatus Returns OS_OK indicating successful task delay.
  *
  * @details
- * The function initializes essential components of the operating system before starting it.
+ * The function performs the following steps to delay a task (OS_voidDelayTaskService):
+ * 1. Removes the task from its ready queue and marks it waiting.
+ * 2. Inserts it in the timeout list with `OS_voidTimeoutInsert`, sorted by wake tick.
+ * 3. Reschedules, a task delaying itself is switched out at once.
  *
  * Example usage:
  * @code
- * OS_enumErrorStatus initStatus = OS_enumInit();
- * if (initStatus != OS_OK) {
- *     // Handle initialization error
- * }
+ * OS_enumDelayTask(&t1, 100);
+ * // t1 runs again 100 ticks later.
  * @endcode
  */
 OS_enumErrorStatus OS_enumDelayTask(OS_structTask* Add_structTask,u32 Copy_u32NoOfTicks);
+/** OS_enumSetPriority
+ * @brief Changes the priority of a created task (SVC_SET_PRIORITY), never write `Priority` directly.
+ *
+ * A ready task moves to the ready queue of its new priority, a task blocked on a kernel object
+ * takes its new place in the wait list, then the scheduler preempts if needed. A running task only
+ * has its field changed. Also the hook for priority inheritance. May be called from interrupt handlers.
+ *
+ * @param Add_structTask Pointer to the task structure.
+ * @param Copy_u8Priority New priority (below `OS_TASK_PRIORITY_LEVELS`).
+ * @return OS_enumErrorStatus Returns OS_OK, or TASK_CREATION_ERROR if the priority is out of range.
+ *
+ * Example usage:
+ * @code
+ * OS_enumSetPriority(&logTask, 1); // Demoted while the control loop is late
+ * @endcode
+ */
+OS_enumErrorStatus OS_enumSetPriority(OS_structTask* Add_structTask, u8 Copy_u8Priority);
 /** OS_enumStartOS
  * @brief Starts the operating system.
  *
@@ -203,6 +365,7 @@ OS_enumErrorStatus OS_enumDelayTask(OS_structTask* Add_structTask,u32 Copy_u32No
  * 2. Sets the current task to the idle task (`Global_structIdleTask`).
  * 3. Activates the idle task using `OS_enumActivateTask`.
  * 4. Starts the system timer using `OS_voidStartTimer`.
+ *    With `OS_MPU_ENABLE`, programs and enables the MPU using `OS_voidMpuInit`.
  * 5. Sets the Process Stack Pointer (PSP) to the idle task's CurrentPSP.
  * 6. Switches to the PSP mode and executes the idle task's function (`func`).
  *
@@ -222,5 +385,13 @@ OS_enumErrorStatus OS_enumDelayTask(OS_structTask* Add_structTask,u32 Copy_u32No
  */
 OS_enumErrorStatus OS_enumStartOS();
 
+/* Kernel side of the APIs, run in Handler Mode */
+OS_enumErrorStatus OS_enumCreateTaskService(OS_structTask* Add_structTask);
+OS_enumErrorStatus OS_enumDeleteTaskService(OS_structTask* Add_structTask);
+void OS_voidSpawnTaskService(OS_tstructSpawnRequest* Add_structRequest);
+void OS_voidDelayTaskService(OS_structTask* Add_structTask, u32 Copy_u32NoOfTicks);
+void OS_voidActivateTasksService(OS_structTask** Add_structTasks, u32 Copy_u32NoOfTasks);
+void OS_voidSetPriorityService(OS_structTask* Add_structTask, u8 Copy_u8Priority);
+
 
 #endif /* INC_TASK_H_ */